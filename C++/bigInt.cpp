@@ -6,12 +6,25 @@
 
 namespace shared_model {
   namespace crypto {
+    namespace {
+      // Giá trị của một ký tự hex (đã được kiểm tra hợp lệ trước đó)
+      uint64_t hex_value(char c) {
+        if (c >= '0' && c <= '9') {
+          return static_cast<uint64_t>(c - '0');
+        }
+        if (c >= 'a' && c <= 'f') {
+          return static_cast<uint64_t>(c - 'a' + 10);
+        }
+        return static_cast<uint64_t>(c - 'A' + 10);
+      }
+    }  // namespace
+
     /*
      * Constructor mặc định
      * @return Đối tượng BigInt mới
      */
     BigInt::BigInt() {
-      data_.push_back(0);  // Khởi tạo với một byte 0
+      limbs_.push_back(0);  // Khởi tạo với một limb 0
     }
 
     /*
@@ -47,19 +60,8 @@ namespace shared_model {
         }
       }
 
-      // 4. Chuyển thành các byte
-      data_.reserve(hex_str.size() / 2);
-      for (size_t i = 0; i < hex_str.size(); i += 2) {
-        std::string byte_str = hex_str.substr(i, 2);
-        try {
-          data_.push_back(
-              static_cast<uint8_t>(std::stoul(byte_str, nullptr, 16)));
-        } catch (const std::exception &) {
-          throw std::invalid_argument("Invalid hex digit: " + byte_str);
-        }
-      }
-
-      trim();
+      // 4. Chuyển thành các limb
+      assign_hex(hex_str);
     }
 
     /*
@@ -67,43 +69,66 @@ namespace shared_model {
      * @param data Vector chứa các byte
      * @return Đối tượng BigInt mới
      */
-    BigInt::BigInt(const std::vector<uint8_t> &data) : data_(data) {
-      trim();  // Ensure no leading zeros
+    BigInt::BigInt(const std::vector<uint8_t> &data) {
+      assign_bytes(data.data(), data.size());
     }
 
     /*
      * Constructor từ uint64_t
      * @param value Giá trị uint64_t
      * @return Đối tượng BigInt mới
-     * @note Giá trị được lưu trữ theo thứ tự big-endian
      */
     BigInt::BigInt(uint64_t value) {
-      // Chuyển đổi uint64_t thành vector byte
-      data_.resize(sizeof(value));
-      for (size_t i = 0; i < sizeof(value); ++i) {
-        data_[sizeof(value) - 1 - i] = static_cast<uint8_t>(value >> (i * 8));
-      }
-      trim();  // Ensure no leading zeros
+      limbs_.push_back(value);
     }
 
     /*
-     * Hàm trim() để loại bỏ các byte 0 ở đầu dữ liệu
+     * Hàm trim() để loại bỏ các limb 0 ở đầu dữ liệu
      * (nếu có) để đảm bảo rằng số nguyên không có
      * tiền tố không cần thiết.
-     * @param data_ Dữ liệu BigInt
+     * @param limbs_ Dữ liệu BigInt
      */
     void BigInt::trim() {
-      // Loại bỏ các byte 0 ở đầu
-      while (data_.size() > 1 && data_[0] == 0) {
-        data_.erase(data_.begin());
+      // Loại bỏ các limb 0 ở đầu (nằm ở cuối vector vì little-endian)
+      while (limbs_.size() > 1 && limbs_.back() == 0) {
+        limbs_.pop_back();
       }
 
       // Đảm bảo vector không rỗng
-      if (data_.empty()) {
-        data_.push_back(0);
+      if (limbs_.empty()) {
+        limbs_.push_back(0);
       }
     }
 
+    /*
+     * Hàm assign_bytes() gán giá trị từ dãy byte big-endian
+     * @param bytes Con trỏ tới byte đầu tiên (byte cao nhất)
+     * @param len Số byte
+     */
+    void BigInt::assign_bytes(const uint8_t *bytes, size_t len) {
+      limbs_.assign((len + 7) / 8, 0);
+      for (size_t i = 0; i < len; ++i) {
+        // byte thứ i tính từ cuối là byte có trọng số 256^i
+        limbs_[i / 8] |= static_cast<uint64_t>(bytes[len - 1 - i])
+            << ((i % 8) * 8);
+      }
+      trim();
+    }
+
+    /*
+     * Hàm assign_hex() gán giá trị từ chuỗi chữ số hex (không có "0x")
+     * @param digits Chuỗi hex đã được kiểm tra hợp lệ
+     */
+    void BigInt::assign_hex(const std::string &digits) {
+      size_t len = digits.size();
+      limbs_.assign((len + 15) / 16, 0);
+      for (size_t i = 0; i < len; ++i) {
+        // chữ số thứ i tính từ cuối có trọng số 16^i
+        limbs_[i / 16] |= hex_value(digits[len - 1 - i]) << ((i % 16) * 4);
+      }
+      trim();
+    }
+
     /*
      * hàm from_hex() để tạo một đối tượng BigInt từ chuỗi hex
      * @param hex_str Chuỗi hex
@@ -138,17 +163,9 @@ namespace shared_model {
         }
       }
 
-      // 5. Tạo đối tượng BigInt và chuyển chuỗi hex thành các byte
+      // 5. Tạo đối tượng BigInt và chuyển chuỗi hex thành các limb
       BigInt result;
-      result.data_.reserve(hex.size() / 2);
-      for (size_t i = 0; i < hex.size(); i += 2) {
-        std::string byte_str = hex.substr(i, 2);
-        result.data_.push_back(
-            static_cast<uint8_t>(std::stoul(byte_str, nullptr, 16)));
-      }
-
-      // 6. Trim dữ liệu (nếu cần)
-      result.trim();
+      result.assign_hex(hex);
 
       return result;
     }
@@ -165,16 +182,54 @@ namespace shared_model {
         throw std::invalid_argument("Byte vector cannot be empty");
       }
 
-      // 2. Tạo đối tượng BigInt và sao chép các byte vào data_
+      // 2. Tạo đối tượng BigInt và chuyển các byte thành limb
       BigInt result;
-      result.data_ = bytes;  // Sao chép trực tiếp các byte vào data_
+      result.assign_bytes(bytes.data(), bytes.size());
 
-      // 3. Trim dữ liệu (nếu cần)
-      result.trim();
+      return result;
+    }
 
+    /*
+     * hàm from_limbs() để tạo một đối tượng BigInt từ mảng limb 64-bit
+     * @param limbs Con trỏ tới limb thấp nhất
+     * @param count Số limb
+     * @return Đối tượng BigInt tương ứng
+     * @note Các limb được đọc theo thứ tự little-endian
+     */
+    BigInt BigInt::from_limbs(const uint64_t *limbs, size_t count) {
+      BigInt result;
+      if (count > 0) {
+        result.limbs_.assign(limbs, limbs + count);
+        result.trim();
+      }
       return result;
     }
 
+    /*
+     * getter cho dữ liệu dạng byte
+     * @return vector chứa các byte (bản sao)
+     * @note Các byte được trả về theo thứ tự big-endian, không có byte 0 ở
+     * đầu
+     */
+    std::vector<uint8_t> BigInt::data() const {
+      size_t len = size();
+      std::vector<uint8_t> bytes(len);
+      for (size_t i = 0; i < len; ++i) {
+        bytes[len - 1 - i] =
+            static_cast<uint8_t>(limbs_[i / 8] >> ((i % 8) * 8));
+      }
+      return bytes;
+    }
+
+    /*
+     * hàm size() trả về số byte cần để biểu diễn BigInt
+     * @return Số byte (tối thiểu là 1)
+     */
+    size_t BigInt::size() const {
+      size_t bytes = (bit_length() + 7) / 8;
+      return bytes == 0 ? 1 : bytes;
+    }
+
     /*
      * hàm to_hex() để chuyển đổi đối tượng BigInt thành chuỗi hex
      * @return Chuỗi hex tương ứng
@@ -184,9 +239,12 @@ namespace shared_model {
     std::string BigInt::to_hex() const {
       std::ostringstream oss;
       oss << "0x";  // Thêm tiền tố
-      for (auto byte : data_) {
-        oss << std::hex << std::setw(2) << std::setfill('0')
-            << static_cast<int>(byte);
+      // Limb cao nhất chỉ in đủ số byte cần thiết
+      size_t top_bytes = size() - (limbs_.size() - 1) * 8;
+      oss << std::hex << std::setfill('0')
+          << std::setw(static_cast<int>(top_bytes * 2)) << limbs_.back();
+      for (size_t i = limbs_.size() - 1; i-- > 0;) {
+        oss << std::setw(16) << limbs_[i];
       }
       return oss.str();
     }
@@ -198,47 +256,11 @@ namespace shared_model {
      * @note Nếu một trong hai đối tượng là 0, trả về đối tượng còn lại
      */
     BigInt BigInt::operator+(const BigInt &rhs) const {
-      // Đảm bảo dữ liệu của cả hai đối tượng BigInt là hợp lệ
-      // nếu rhs = 0
-      if (rhs.data_.empty()) {
-        return *this;  // Nếu rhs là 0, trả về chính nó
-      }
-      if (data_.empty()) {
-        return rhs;  // Nếu data_ là 0, trả về rhs
-      }
-      size_t max_size = std::max(data_.size(), rhs.data_.size());
-      std::vector<uint8_t> temp_result;
-      temp_result.reserve(
-          max_size
-          + 1);  // Dự trữ bộ nhớ cho phép cộng có thể tạo ra một byte dư
-
-      uint8_t carry = 0;  // Biến carry để lưu trữ giá trị mang theo
-
-      // Thực hiện phép cộng từng byte từ phải sang trái (big-endian)
-      size_t i = data_.size();
-      size_t j = rhs.data_.size();
-
-      while (i > 0 || j > 0 || carry != 0) {
-        uint8_t byte1 = (i > 0)
-            ? data_[--i]
-            : 0;  // Lấy byte từ data_ nếu còn, nếu không lấy 0
-        uint8_t byte2 = (j > 0) ? rhs.data_[--j] : 0;  // Tương tự cho rhs
-
-        // Tính tổng của byte1, byte2 và carry
-        uint16_t sum = (uint16_t)byte1 + (uint16_t)byte2 + carry;
-
-        // Cập nhật carry
-        carry = sum >= 256 ? 1 : 0;
-
-        // Lưu kết quả vào data_ của đối tượng result
-        temp_result.push_back(sum & 0xFF);  // Lấy phần dư khi chia cho 256
-      }
-
-      std::reverse(temp_result.begin(), temp_result.end());
-
-      BigInt result(temp_result);
-      result.trim();
-      // Trả về kết quả cộng
+      BigInt result;
+      // Dự trữ thêm một limb cho carry cuối cùng để += không cấp phát lại
+      result.limbs_.reserve(std::max(limbs_.size(), rhs.limbs_.size()) + 1);
+      result.limbs_ = limbs_;
+      result += rhs;
       return result;
     }
 
@@ -250,53 +272,8 @@ namespace shared_model {
      * @note Nếu *this < rhs, ném ngoại lệ std::invalid_argument
      */
     BigInt BigInt::operator-(const BigInt &rhs) const {
-      // Đảm bảo dữ liệu của cả hai đối tượng BigInt là hợp lệ
-      if (*this < rhs) {
-        throw std::invalid_argument(
-            "Cannot subtract a larger number from a smaller one");
-      }
-
-      // Nếu rhs = 0, trả về chính nó
-      if (rhs.data_.empty()) {
-        return *this;  // Nếu rhs là 0, trả về chính nó
-      }
-
-      std::vector<uint8_t> temp_result;
-      temp_result.reserve(
-          std::max(data_.size(), rhs.data_.size()));  // Dự trữ bộ nhớ
-
-      uint8_t borrow = 0;  // Biến borrow để lưu trữ giá trị mượn
-
-      // Thực hiện phép trừ từng byte từ phải sang trái (big-endian)
-      size_t i = data_.size();
-      size_t j = rhs.data_.size();
-
-      while (i > 0 || j > 0 || borrow != 0) {
-        uint8_t byte1 = (i > 0)
-            ? data_[--i]
-            : 0;  // Lấy byte từ data_ nếu còn, nếu không lấy 0
-        uint8_t byte2 = (j > 0) ? rhs.data_[--j] : 0;  // Tương tự cho rhs
-
-        // Tính hiệu của byte1 và byte2, cộng với borrow
-        int16_t diff = byte1 - byte2 - borrow;
-
-        // Nếu kết quả nhỏ hơn 0, cần mượn
-        if (diff < 0) {
-          diff += 256;
-          borrow = 1;  // Cập nhật borrow
-        } else {
-          borrow = 0;  // Không cần mượn
-        }
-
-        // Lưu kết quả vào data_ của đối tượng result
-        temp_result.push_back(diff & 0xFF);  // Lấy phần dư khi chia cho 256
-      }
-      std::reverse(temp_result.begin(), temp_result.end());
-      BigInt result(temp_result);
-      // Cắt bỏ các byte thừa không cần thiết (0 phía trước)
-      result.trim();
-
-      // Trả về kết quả trừ
+      BigInt result(*this);
+      result -= rhs;
       return result;
     }
 
@@ -305,57 +282,35 @@ namespace shared_model {
      * @param rhs Đối tượng BigInt bên phải
      * @return Đối tượng BigInt kết quả của phép nhân
      * @note Nếu một trong hai đối tượng là 0, trả về 0
-     * @note Nếu một trong hai đối tượng là 1, trả về đối tượng còn lại
      */
     BigInt BigInt::operator*(const BigInt &rhs) const {
-      // Đảm bảo dữ liệu của cả hai đối tượng BigInt là hợp lệ
-      if (data_.empty() || rhs.data_.empty()) {
-        return BigInt(0);  // Nếu một trong hai đối tượng là 0, trả về 0
-      }
-      if (rhs == BigInt(1)) {
-        return *this;  // Nếu rhs là 1, trả về chính nó
-      }
-      if (*this == BigInt(1)) {
-        return rhs;  // Nếu *this là 1, trả về rhs
+      // Nếu một trong hai đối tượng là 0, trả về 0
+      if ((limbs_.size() == 1 && limbs_[0] == 0)
+          || (rhs.limbs_.size() == 1 && rhs.limbs_[0] == 0)) {
+        return BigInt(0);
       }
-      // Khởi tạo đối tượng BigInt để lưu kết quả
-      BigInt result;
-
-      // Cấp phát bộ nhớ cho result, tối đa cần 2 lần kích thước của hai số
-      result.data_.resize(data_.size() + rhs.data_.size(), 0);
-
-      // Nhân từng byte của data_ với từng byte của rhs.data_
-      for (size_t i = 0; i < data_.size(); ++i) {
-        uint8_t byte1 = data_[data_.size() - 1 - i];  // Lấy byte từ data_
-        uint8_t carry = 0;
 
-        for (size_t j = 0; j < rhs.data_.size(); ++j) {
-          uint8_t byte2 =
-              rhs.data_[rhs.data_.size() - 1 - j];  // Lấy byte từ rhs
-
-          // Tính tích của byte1 và byte2, cộng với carry (nếu có)
-          uint16_t product = byte1 * byte2
-              + result.data_[result.data_.size() - 1 - (i + j)] + carry;
-
-          // Cập nhật carry và lưu kết quả vào data_
-          result.data_[result.data_.size() - 1 - (i + j)] =
-              static_cast<uint8_t>(product % 256);
-          carry = product / 256;  // Cập nhật carry
-        }
-
-        // Nếu còn carry sau khi nhân với tất cả các byte của rhs, lưu carry vào
-        // kết quả
-        size_t carry_position =
-            result.data_.size() - 1 - (i + rhs.data_.size());
-        while (carry != 0) {
-          uint16_t product = result.data_[carry_position] + carry;
-          result.data_[carry_position] = static_cast<uint8_t>(product % 256);
-          carry = product / 256;
-          --carry_position;
+      // Khởi tạo đối tượng BigInt để lưu kết quả, tối đa cần tổng số limb
+      // của hai số
+      BigInt result;
+      result.limbs_.assign(limbs_.size() + rhs.limbs_.size(), 0);
+
+      // Nhân từng limb của limbs_ với từng limb của rhs.limbs_
+      for (size_t i = 0; i < limbs_.size(); ++i) {
+        uint128_t carry = 0;
+        for (size_t j = 0; j < rhs.limbs_.size(); ++j) {
+          // Tích 64x64 bit cộng với limb hiện tại và carry không vượt quá
+          // 128 bit
+          uint128_t product =
+              static_cast<uint128_t>(limbs_[i]) * rhs.limbs_[j]
+              + result.limbs_[i + j] + carry;
+          result.limbs_[i + j] = static_cast<uint64_t>(product);
+          carry = product >> 64;
         }
+        result.limbs_[i + rhs.limbs_.size()] = static_cast<uint64_t>(carry);
       }
 
-      // Cắt bỏ các byte thừa không cần thiết (0 phía trước)
+      // Cắt bỏ các limb thừa không cần thiết (0 phía trước)
       result.trim();
 
       // Trả về kết quả nhân
@@ -367,21 +322,14 @@ namespace shared_model {
      * @return Số bit của BigInt
      */
     size_t BigInt::bit_length() const {
-      // Traverse from highest byte (data_[0]) down
-      for (size_t i = 0; i < data_.size(); ++i) {
-        uint8_t byte = data_[i];
-
-        if (byte != 0) {
-          int bits = 0;
-          // Count bits in the highest non-zero byte
-          while (byte) {
-            byte >>= 1;
-            ++bits;
-          }
-          return (data_.size() - i - 1) * 8 + bits;
-        }
+      // limb cao nhất nằm ở cuối vector, sau trim() chỉ có thể là 0 nếu số
+      // bằng 0
+      uint64_t top = limbs_.back();
+      if (top == 0) {
+        return 0;
       }
-      return 0;
+      return (limbs_.size() - 1) * 64
+          + (64 - static_cast<size_t>(__builtin_clzll(top)));
     }
 
     /*
@@ -390,99 +338,337 @@ namespace shared_model {
      * @return true nếu bit thứ `pos` là 1, false nếu không
      */
     bool BigInt::test_bit(size_t pos) const {
-      // Calculate byte index from MSB
-      size_t byte_idx = data_.size() - 1 - pos / 8;
-      size_t bit_idx = pos % 8;
-      return (data_[byte_idx] >> bit_idx) & 1;
+      size_t limb_idx = pos / 64;
+      if (limb_idx >= limbs_.size()) {
+        return false;
+      }
+      return (limbs_[limb_idx] >> (pos % 64)) & 1;
     }
 
-    BigInt BigInt::operator/(const BigInt &divisor) const {
+    /*
+     * hàm count_trailing_zeros() đếm số bit 0 liên tiếp từ LSB
+     * @return Số mũ lớn nhất r sao cho 2^r chia hết BigInt; 0 nếu BigInt = 0
+     */
+    size_t BigInt::count_trailing_zeros() const {
+      for (size_t i = 0; i < limbs_.size(); ++i) {
+        if (limbs_[i] != 0) {
+          return i * 64 + static_cast<size_t>(__builtin_ctzll(limbs_[i]));
+        }
+      }
+      return 0;
+    }
+
+    /*
+     * Hàm chia lấy cả thương và số dư trong một lần chia
+     * @param divisor Số chia
+     * @return Cặp (thương, số dư)
+     * @throws std::invalid_argument nếu divisor = 0
+     * @note Sử dụng thuật toán chia nhiều limb (Knuth, TAOCP Vol. 2,
+     * 4.3.1, Algorithm D)
+     */
+    std::pair<BigInt, BigInt> BigInt::divmod(const BigInt &divisor) const {
       // 1. Kiểm tra chia cho 0
-      if (divisor == BigInt(0)) {
-        throw std::invalid_argument("Chia cho 0");
+      if (divisor.limbs_.size() == 1 && divisor.limbs_[0] == 0) {
+        throw std::invalid_argument("Division by zero");
       }
 
-      BigInt dividend = *this;
-      // 2. Các trường hợp nhanh
-      if (dividend < divisor)
-        return BigInt(0);
-      if (dividend == divisor)
-        return BigInt(1);
-      if (divisor == BigInt(1))
-        return dividend;
+      // 2. Trường hợp nhanh: số bị chia nhỏ hơn số chia
+      if (*this < divisor) {
+        return {BigInt(0), *this};
+      }
 
-      // 3. Khởi tạo quotient và remainder
-      BigInt quotient(0);
-      BigInt remainder(0);
+      const size_t n = divisor.limbs_.size();
+      const size_t m = limbs_.size() - n;
 
-      // 4. Tổng số bit
-      size_t total_bits = dividend.bit_length();
+      BigInt quotient;
+      quotient.limbs_.assign(m + 1, 0);
 
-      // 5. Thuật toán chia nhị phân
-      for (int i = (int)total_bits - 1; i >= 0; --i) {
-        // Dịch trái remainder (nhân đôi)
+      // 3. Số chia chỉ có một limb: chia ngắn từ limb cao xuống thấp
+      if (n == 1) {
+        const uint64_t d = divisor.limbs_[0];
+        uint128_t rem = 0;
+        for (size_t i = limbs_.size(); i-- > 0;) {
+          uint128_t cur = (rem << 64) | limbs_[i];
+          quotient.limbs_[i] = static_cast<uint64_t>(cur / d);
+          rem = cur % d;
+        }
+        quotient.trim();
+        return {quotient, BigInt(static_cast<uint64_t>(rem))};
+      }
 
-        remainder = remainder + remainder;
+      // 4. Chuẩn hoá: dịch trái để bit cao nhất của số chia bằng 1
+      const unsigned shift =
+          static_cast<unsigned>(__builtin_clzll(divisor.limbs_.back()));
+      std::vector<uint64_t> v(n);
+      std::vector<uint64_t> u(limbs_.size() + 1);
+      for (size_t i = n; i-- > 0;) {
+        v[i] = divisor.limbs_[i] << shift;
+        if (shift != 0 && i > 0) {
+          v[i] |= divisor.limbs_[i - 1] >> (64 - shift);
+        }
+      }
+      u[limbs_.size()] = shift != 0 ? limbs_.back() >> (64 - shift) : 0;
+      for (size_t i = limbs_.size(); i-- > 0;) {
+        u[i] = limbs_[i] << shift;
+        if (shift != 0 && i > 0) {
+          u[i] |= limbs_[i - 1] >> (64 - shift);
+        }
+      }
 
-        // Thêm bit thứ i của dividend vào remainder
-        if (dividend.test_bit(i)) {
-          remainder = remainder + BigInt(1);
+      // 5. Tính từng limb của thương từ cao xuống thấp
+      const uint128_t base = static_cast<uint128_t>(1) << 64;
+      for (size_t j = m + 1; j-- > 0;) {
+        // 5.1 Ước lượng qhat từ hai limb cao của phần dư hiện tại
+        uint128_t top = (static_cast<uint128_t>(u[j + n]) << 64) | u[j + n - 1];
+        uint128_t qhat = top / v[n - 1];
+        uint128_t rhat = top % v[n - 1];
+        while (qhat >= base
+               || qhat * v[n - 2] > ((rhat << 64) | u[j + n - 2])) {
+          --qhat;
+          rhat += v[n - 1];
+          if (rhat >= base) {
+            break;
+          }
         }
 
-        // Dịch trái quotient (nhân đôi)
-        quotient = quotient + quotient;
+        // 5.2 Nhân và trừ: u[j..j+n] -= qhat * v
+        uint64_t borrow = 0;
+        uint64_t carry = 0;
+        for (size_t i = 0; i < n; ++i) {
+          uint128_t product = qhat * v[i] + carry;
+          carry = static_cast<uint64_t>(product >> 64);
+          uint128_t diff = static_cast<uint128_t>(u[i + j])
+              - static_cast<uint64_t>(product) - borrow;
+          u[i + j] = static_cast<uint64_t>(diff);
+          borrow = static_cast<uint64_t>(diff >> 64) != 0 ? 1 : 0;
+        }
+        uint128_t diff =
+            static_cast<uint128_t>(u[j + n]) - carry - borrow;
+        u[j + n] = static_cast<uint64_t>(diff);
+
+        // 5.3 qhat lớn hơn 1 đơn vị (hiếm gặp): cộng lại số chia
+        if (static_cast<uint64_t>(diff >> 64) != 0) {
+          --qhat;
+          uint64_t add_carry = 0;
+          for (size_t i = 0; i < n; ++i) {
+            uint128_t sum =
+                static_cast<uint128_t>(u[i + j]) + v[i] + add_carry;
+            u[i + j] = static_cast<uint64_t>(sum);
+            add_carry = static_cast<uint64_t>(sum >> 64);
+          }
+          u[j + n] += add_carry;
+        }
+        quotient.limbs_[j] = static_cast<uint64_t>(qhat);
+      }
 
-        // Nếu remainder >= divisor, trừ divisor và đặt bit 1 cho quotient
-        if (remainder >= divisor) {
-          remainder = remainder - divisor;
-          // Đặt bit thấp nhất của quotient
-          quotient.data_[quotient.data_.size() - 1] |= 1;
+      // 6. Số dư là n limb thấp của u, dịch phải để bỏ chuẩn hoá
+      BigInt remainder;
+      remainder.limbs_.resize(n);
+      for (size_t i = 0; i < n; ++i) {
+        remainder.limbs_[i] = u[i] >> shift;
+        if (shift != 0) {
+          remainder.limbs_[i] |= u[i + 1] << (64 - shift);
         }
       }
 
-      // 6. Loại bỏ byte 0 thừa
+      // 7. Loại bỏ limb 0 thừa
       quotient.trim();
+      remainder.trim();
 
-      return quotient;
+      return {quotient, remainder};
+    }
+
+    BigInt BigInt::operator/(const BigInt &divisor) const {
+      return divmod(divisor).first;
     }
 
     BigInt BigInt::operator%(const BigInt &divisor) const {
-      if (divisor == BigInt(0)) {
-        throw std::invalid_argument("Division by zero");
+      // Trường hợp nhanh: đã nhỏ hơn modulo
+      if (*this < divisor) {
+        return *this;
       }
-
-      BigInt quotient = *this / divisor;
-      BigInt product = quotient * divisor;
-      BigInt remainder = *this - product;
-
-      return remainder;
+      return divmod(divisor).second;
     }
 
     BigInt &BigInt::operator+=(const BigInt &rhs) {
-      *this = *this + rhs;
+      // rhs có thể chính là *this: chỉ đọc rhs.limbs_[i] trước khi ghi
+      // limbs_[i], và limbs_ chỉ mở rộng khi rhs dài hơn (không thể trùng)
+      const size_t rhs_size = rhs.limbs_.size();
+      if (limbs_.size() < rhs_size) {
+        limbs_.resize(rhs_size, 0);
+      }
+
+      uint128_t carry = 0;  // Biến carry để lưu trữ giá trị mang theo
+
+      // Thực hiện phép cộng từng limb từ thấp đến cao (little-endian),
+      // dừng sớm khi hết rhs và không còn carry
+      for (size_t i = 0; i < limbs_.size(); ++i) {
+        if (i >= rhs_size && carry == 0) {
+          break;
+        }
+        uint128_t sum = carry + limbs_[i];
+        if (i < rhs_size) {
+          sum += rhs.limbs_[i];
+        }
+        limbs_[i] = static_cast<uint64_t>(sum);
+        carry = sum >> 64;
+      }
+      if (carry != 0) {
+        limbs_.push_back(static_cast<uint64_t>(carry));
+      }
       return *this;
     }
+
     BigInt &BigInt::operator-=(const BigInt &rhs) {
-      *this = *this - rhs;
+      // Đảm bảo dữ liệu của cả hai đối tượng BigInt là hợp lệ
+      if (*this < rhs) {
+        throw std::invalid_argument(
+            "Cannot subtract a larger number from a smaller one");
+      }
+
+      uint64_t borrow = 0;  // Biến borrow để lưu trữ giá trị mượn
+
+      // Thực hiện phép trừ từng limb từ thấp đến cao (little-endian),
+      // dừng sớm khi hết rhs và không còn mượn
+      const size_t rhs_size = rhs.limbs_.size();
+      for (size_t i = 0; i < limbs_.size(); ++i) {
+        if (i >= rhs_size && borrow == 0) {
+          break;
+        }
+        uint64_t sub = i < rhs_size ? rhs.limbs_[i] : 0;
+        uint128_t diff = static_cast<uint128_t>(limbs_[i]) - sub - borrow;
+        limbs_[i] = static_cast<uint64_t>(diff);
+        // Nếu kết quả âm, phần cao của diff sẽ khác 0 => cần mượn
+        borrow = static_cast<uint64_t>(diff >> 64) != 0 ? 1 : 0;
+      }
+
+      // Cắt bỏ các limb thừa không cần thiết (0 phía trước)
+      trim();
       return *this;
     }
+
     BigInt &BigInt::operator*=(const BigInt &rhs) {
-      *this = *this * rhs;
+      // Bình phương tại chỗ: rhs.limbs_ sẽ bị ghi đè trong vòng lặp
+      if (&rhs == this) {
+        *this = *this * rhs;
+        return *this;
+      }
+      if ((limbs_.size() == 1 && limbs_[0] == 0)
+          || (rhs.limbs_.size() == 1 && rhs.limbs_[0] == 0)) {
+        limbs_.assign(1, 0);
+        return *this;
+      }
+
+      // Nhân từ limb cao xuống limb thấp: khi xử lý limb i, các vị trí
+      // > i chỉ còn chứa tích riêng phần, nên có thể ghi đè ngay limbs_[i]
+      const size_t n = limbs_.size();
+      const size_t m = rhs.limbs_.size();
+      limbs_.resize(n + m, 0);
+      for (size_t i = n; i-- > 0;) {
+        const uint64_t a = limbs_[i];
+        limbs_[i] = 0;
+        uint128_t carry = 0;
+        for (size_t j = 0; j < m; ++j) {
+          uint128_t product = static_cast<uint128_t>(a) * rhs.limbs_[j]
+              + limbs_[i + j] + carry;
+          limbs_[i + j] = static_cast<uint64_t>(product);
+          carry = product >> 64;
+        }
+        // Lan truyền carry lên các limb cao (tích luôn vừa n + m limb)
+        for (size_t k = i + m; carry != 0; ++k) {
+          uint128_t sum = static_cast<uint128_t>(limbs_[k]) + carry;
+          limbs_[k] = static_cast<uint64_t>(sum);
+          carry = sum >> 64;
+        }
+      }
+
+      trim();
       return *this;
     }
+
     BigInt &BigInt::operator/=(const BigInt &rhs) {
-      *this = *this / rhs;
+      *this = std::move(divmod(rhs).first);
       return *this;
     }
+
     BigInt &BigInt::operator%=(const BigInt &rhs) {
-      *this = *this % rhs;
+      // Trường hợp nhanh: đã nhỏ hơn modulo, không cần chia
+      if (*this < rhs) {
+        return *this;
+      }
+      *this = std::move(divmod(rhs).second);
+      return *this;
+    }
+
+    /*
+     * Hàm dịch trái
+     * @param shift Số bit cần dịch
+     * @return BigInt * 2^shift
+     */
+    BigInt BigInt::operator<<(size_t shift) const {
+      BigInt result(*this);
+      result <<= shift;
+      return result;
+    }
+
+    /*
+     * Hàm dịch phải
+     * @param shift Số bit cần dịch
+     * @return floor(BigInt / 2^shift)
+     */
+    BigInt BigInt::operator>>(size_t shift) const {
+      BigInt result(*this);
+      result >>= shift;
+      return result;
+    }
+
+    BigInt &BigInt::operator<<=(size_t shift) {
+      if (limbs_.size() == 1 && limbs_[0] == 0) {
+        return *this;
+      }
+      const size_t limb_shift = shift / 64;
+      const unsigned bit_shift = static_cast<unsigned>(shift % 64);
+      const size_t old_size = limbs_.size();
+      // Thêm limb_shift limb thấp và một limb cho các bit tràn
+      limbs_.resize(old_size + limb_shift + 1, 0);
+      for (size_t i = old_size; i-- > 0;) {
+        uint64_t limb = limbs_[i];
+        limbs_[i] = 0;
+        if (bit_shift == 0) {
+          limbs_[i + limb_shift] = limb;
+        } else {
+          limbs_[i + limb_shift + 1] |= limb >> (64 - bit_shift);
+          limbs_[i + limb_shift] = limb << bit_shift;
+        }
+      }
+      trim();
+      return *this;
+    }
+
+    BigInt &BigInt::operator>>=(size_t shift) {
+      const size_t limb_shift = shift / 64;
+      const unsigned bit_shift = static_cast<unsigned>(shift % 64);
+      if (limb_shift >= limbs_.size()) {
+        limbs_.assign(1, 0);
+        return *this;
+      }
+      const size_t new_size = limbs_.size() - limb_shift;
+      for (size_t i = 0; i < new_size; ++i) {
+        uint64_t limb = limbs_[i + limb_shift] >> bit_shift;
+        if (bit_shift != 0 && i + limb_shift + 1 < limbs_.size()) {
+          limb |= limbs_[i + limb_shift + 1] << (64 - bit_shift);
+        }
+        limbs_[i] = limb;
+      }
+      limbs_.resize(new_size);
+      trim();
       return *this;
     }
 
     // Comparison operators (basic example)
     bool BigInt::operator==(const BigInt &rhs) const {
       // Sau khi trim, cả hai vector không thể rỗng
-      return data_ == rhs.data_;
+      return limbs_ == rhs.limbs_;
     }
 
     bool BigInt::operator!=(const BigInt &rhs) const {
@@ -491,14 +677,14 @@ namespace shared_model {
 
     bool BigInt::operator<(const BigInt &rhs) const {
       // So sánh kích thước trước
-      if (data_.size() != rhs.data_.size()) {
-        return data_.size() < rhs.data_.size();
+      if (limbs_.size() != rhs.limbs_.size()) {
+        return limbs_.size() < rhs.limbs_.size();
       }
 
-      // So sánh từng byte từ trái sang phải
-      for (size_t i = 0; i < data_.size(); i++) {
-        if (data_[i] != rhs.data_[i]) {
-          return data_[i] < rhs.data_[i];
+      // So sánh từng limb từ cao xuống thấp
+      for (size_t i = limbs_.size(); i-- > 0;) {
+        if (limbs_[i] != rhs.limbs_[i]) {
+          return limbs_[i] < rhs.limbs_[i];
         }
       }
 
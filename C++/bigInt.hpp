@@ -7,11 +7,15 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace shared_model {
   namespace crypto {
 
+    // Kiểu 128-bit dùng cho tích và carry của các limb 64-bit
+    __extension__ typedef unsigned __int128 uint128_t;
+
     class BigInt {
      public:
       /*
@@ -39,32 +43,29 @@ namespace shared_model {
        */
       BigInt(const std::vector<uint8_t> &data);
 
-      /*
-       * Constructor sao chép
-       * @param other Đối tượng BigInt khác
-       * @return Đối tượng BigInt mới
-       */
-      BigInt(const BigInt &other) = default;
-
       /*
        * Constructor từ uint64_t
        * @param value Giá trị uint64_t
        * @return Đối tượng BigInt mới
-       * @note Giá trị được lưu trữ theo thứ tự big-endian
        */
       explicit BigInt(uint64_t value);
 
       /*
-       * getter cho dữ liệu
-       * @return vector chứa các byte
-       * @note Dữ liệu được lưu trữ theo thứ tự big-endian
+       * getter cho dữ liệu dạng byte
+       * @return vector chứa các byte (bản sao)
+       * @note Các byte được trả về theo thứ tự big-endian, không có byte 0 ở
+       * đầu
        */
-      const std::vector<uint8_t> &data() const {
-        return data_;
-      }
+      std::vector<uint8_t> data() const;
 
-      std::vector<uint8_t> &data() {
-        return data_;
+      /*
+       * getter cho các limb 64-bit
+       * @return vector chứa các limb
+       * @note Các limb được lưu trữ theo thứ tự little-endian (limb 0 là
+       * limb thấp nhất)
+       */
+      const std::vector<uint64_t> &limbs() const {
+        return limbs_;
       }
 
       /*
@@ -86,6 +87,15 @@ namespace shared_model {
        */
       static BigInt from_bytes(const std::vector<uint8_t> &bytes);
 
+      /*
+       * hàm from_limbs() để tạo một đối tượng BigInt từ mảng limb 64-bit
+       * @param limbs Con trỏ tới limb thấp nhất
+       * @param count Số limb
+       * @return Đối tượng BigInt tương ứng
+       * @note Các limb được đọc theo thứ tự little-endian
+       */
+      static BigInt from_limbs(const uint64_t *limbs, size_t count);
+
       /*
        * hàm to_hex() để chuyển đổi đối tượng BigInt thành chuỗi hex
        * @return Chuỗi hex tương ứng
@@ -94,9 +104,11 @@ namespace shared_model {
        */
       std::string to_hex() const;
 
-      size_t size() const {
-        return data_.size();
-      }
+      /*
+       * hàm size() trả về số byte cần để biểu diễn BigInt
+       * @return Số byte (tối thiểu là 1)
+       */
+      size_t size() const;
 
       /*
        * hàm bit_length() để tính số bit của BigInt
@@ -111,6 +123,73 @@ namespace shared_model {
        */
       bool test_bit(size_t pos) const;
 
+      /*
+       * Kiểm tra tính chẵn lẻ chỉ bằng bit thấp nhất (không chia)
+       * @return true nếu BigInt lẻ
+       */
+      bool is_odd() const {
+        return limbs_[0] & 1;
+      }
+
+      /*
+       * hàm count_trailing_zeros() đếm số bit 0 liên tiếp từ LSB
+       * @return Số mũ lớn nhất r sao cho 2^r chia hết BigInt; 0 nếu BigInt = 0
+       */
+      size_t count_trailing_zeros() const;
+
+      /*
+       * Bộ duyệt các bit từ MSB xuống LSB (bit_length() bit), dùng cho các
+       * vòng lặp square-and-multiply / double-and-add
+       * @note BigInt phải tồn tại lâu hơn bộ duyệt
+       */
+      class BitIterator {
+       public:
+        BitIterator(const BigInt *owner, size_t remaining)
+            : owner_(owner), remaining_(remaining) {}
+
+        bool operator*() const {
+          size_t pos = remaining_ - 1;
+          return (owner_->limbs_[pos / 64] >> (pos % 64)) & 1;
+        }
+        BitIterator &operator++() {
+          --remaining_;
+          return *this;
+        }
+        bool operator!=(const BitIterator &rhs) const {
+          return remaining_ != rhs.remaining_;
+        }
+
+       private:
+        const BigInt *owner_;
+        size_t remaining_;  // Số bit chưa duyệt, bit hiện tại là remaining_ - 1
+      };
+
+      class BitRange {
+       public:
+        explicit BitRange(const BigInt *owner) : owner_(owner) {}
+        BitIterator begin() const {
+          return BitIterator(owner_, owner_->bit_length());
+        }
+        BitIterator end() const {
+          return BitIterator(owner_, 0);
+        }
+
+       private:
+        const BigInt *owner_;
+      };
+
+      /*
+       * hàm bits_msb_first() trả về dãy bit từ MSB xuống LSB
+       * @return Dãy bit, dùng được trong range-based for:
+       *   for (bool bit : exp.bits_msb_first()) { ... }
+       * @note Dãy bit chỉ giữ con trỏ tới BigInt nên không được gọi trên giá
+       * trị tạm thời (overload cho rvalue bị xóa)
+       */
+      BitRange bits_msb_first() const & {
+        return BitRange(this);
+      }
+      BitRange bits_msb_first() const && = delete;
+
       // Arithmetic operators
       BigInt operator+(const BigInt &rhs) const;
       BigInt operator-(const BigInt &rhs) const;
@@ -118,12 +197,33 @@ namespace shared_model {
       BigInt operator/(const BigInt &rhs) const;
       BigInt operator%(const BigInt &rhs) const;
 
+      /*
+       * Hàm chia lấy cả thương và số dư trong một lần chia
+       * @param divisor Số chia
+       * @return Cặp (thương, số dư)
+       * @throws std::invalid_argument nếu divisor = 0
+       * @note Sử dụng thuật toán chia nhiều limb (Knuth, Algorithm D)
+       */
+      std::pair<BigInt, BigInt> divmod(const BigInt &divisor) const;
+
+      /*
+       * Các phép toán gán làm việc trực tiếp trên limbs_ của đối tượng,
+       * tái sử dụng bộ nhớ đã cấp phát (chỉ cấp phát khi cần thêm limb)
+       * @note Sao chép và di chuyển dùng các hàm mặc định; đối tượng đã bị
+       * di chuyển chỉ được phép gán lại hoặc hủy
+       */
       BigInt &operator+=(const BigInt &rhs);
       BigInt &operator-=(const BigInt &rhs);
       BigInt &operator*=(const BigInt &rhs);
       BigInt &operator/=(const BigInt &rhs);
       BigInt &operator%=(const BigInt &rhs);
 
+      // Shift operators (dịch theo bit, không dùng phép chia)
+      BigInt operator<<(size_t shift) const;
+      BigInt operator>>(size_t shift) const;
+      BigInt &operator<<=(size_t shift);
+      BigInt &operator>>=(size_t shift);
+
       // Comparison operators
       bool operator==(const BigInt &rhs) const;
       bool operator!=(const BigInt &rhs) const;
@@ -139,7 +239,10 @@ namespace shared_model {
 
      private:
       void trim();
-      std::vector<uint8_t> data_;  // Big-endian
+      void assign_bytes(const uint8_t *bytes, size_t len);
+      void assign_hex(const std::string &digits);
+
+      std::vector<uint64_t> limbs_;  // Little-endian, 64-bit limbs
     };
 
   }  // namespace crypto
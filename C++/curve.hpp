@@ -0,0 +1,99 @@
+#ifndef CURVE_HPP
+#define CURVE_HPP
+
+#include <cstddef>
+
+#include "bigInt.hpp"
+#include "field_ops.hpp"
+#include "jacobian.hpp"
+#include "point.hpp"
+#include "wnaf.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Đường cong y^2 = x^3 + a * x + b với các đặc tính biết lúc biên dịch
+     * @tparam Field FieldOps của đường cong (xem field_ops.hpp);
+     * Field::kCoefficientA quyết định công thức nhân đôi và kiểm tra điểm:
+     *   kZero       y^2 = x^3 + b
+     *   kMinusThree y^2 = (x^2 - 3) * x + b
+     *   kGeneric    y^2 = (x^2 + a) * x + b, a đọc lúc chạy từ Field
+     * @note EllipticCurve là lớp bao lúc chạy: mọi phép toán điểm của nó đi
+     * qua Curve<Field> phù hợp, chọn bằng withCurve()
+     */
+    template <class Field>
+    class Curve {
+     public:
+      using Element = typename Field::Element;
+      static constexpr CoefficientA kCoefficientA = Field::kCoefficientA;
+
+      /*
+       * @param F FieldOps của trường Z_p
+       * @param b Hệ số b (dạng thường)
+       */
+      Curve(const Field &F, const BigInt &b) : F_(F), b_(F.fromBigInt(b)) {}
+
+      const Field &field() const {
+        return F_;
+      }
+
+      /*
+       * Hàm kiểm tra điểm affine nằm trên đường cong
+       * @return true nếu P là điểm vô cực hoặc thỏa phương trình
+       */
+      bool isOnCurve(const AffinePoint<Field> &P) const {
+        if (P.infinity) {
+          return true;
+        }
+        Element xx = F_.sqr(P.x);
+        if constexpr (kCoefficientA == CoefficientA::kMinusThree) {
+          // a = -3 chỉ có ở trường cố định (P256FieldOps) nên hằng số 3 được
+          // dựng một lần cho mọi lời gọi
+          static const Element kThree = F_.fromBigInt(BigInt(3));
+          xx = F_.sub(xx, kThree);
+        } else if constexpr (kCoefficientA == CoefficientA::kGeneric) {
+          if (!F_.aIsZero()) {
+            xx = F_.add(xx, F_.a());
+          }
+        }
+        Element rhs = F_.add(F_.mul(xx, P.x), b_);
+        return F_.eq(F_.sqr(P.y), rhs);
+      }
+
+      bool isOnCurve(const Point &P) const {
+        return isOnCurve(toFieldAffine(F_, P));
+      }
+
+      JacobianPoint<Field> add(const JacobianPoint<Field> &P,
+                               const JacobianPoint<Field> &Q) const {
+        return jacobianAdd(F_, P, Q);
+      }
+
+      JacobianPoint<Field> addMixed(const JacobianPoint<Field> &P,
+                                    const AffinePoint<Field> &Q) const {
+        return jacobianAddMixed(F_, P, Q);
+      }
+
+      /*
+       * Hàm nhân điểm bằng wNAF
+       * @param P Điểm affine
+       * @param k Số nhân không âm
+       * @param window Độ rộng cửa sổ wNAF, trong [2, 8]
+       * @return k * P ở tọa độ Jacobian
+       */
+      JacobianPoint<Field> multiply(const AffinePoint<Field> &P,
+                                    const BigInt &k,
+                                    size_t window) const {
+        return wnafMultiply(F_, P, k, window);
+      }
+
+     private:
+      Field F_;
+      Element b_;  // Hệ số b trong biểu diễn của Field
+    };
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // CURVE_HPP
@@ -0,0 +1,107 @@
+#include "curve_registry.hpp"
+
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+namespace shared_model {
+  namespace crypto {
+
+    namespace {
+      // Tên khác của các đường cong (SEC 2 / NIST)
+      struct CurveAlias {
+        const char *alias;
+        const char *name;
+      };
+      const CurveAlias kAliases[] = {
+          {"secp256r1", "P-256"},
+          {"prime256v1", "P-256"},
+      };
+
+      // Dựng một lần, lần đầu được dùng (tránh thứ tự khởi tạo biến tĩnh)
+      const std::vector<CurveParams> &registry() {
+        static const std::vector<CurveParams> curves = {
+            {"secp256k1",
+             BigInt::from_hex("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"
+                              "FFFFFFFEFFFFFC2F"),
+             BigInt(0),
+             BigInt(7),
+             BigInt::from_hex("0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D9"
+                              "59F2815B16F81798"),
+             BigInt::from_hex("0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A6855419"
+                              "9C47D08FFB10D4B8"),
+             BigInt::from_hex("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03B"
+                              "BFD25E8CD0364141"),
+             1},
+            {"P-256",
+             BigInt::from_hex("0xFFFFFFFF00000001000000000000000000000000FFFFFFFF"
+                              "FFFFFFFFFFFFFFFF"),
+             BigInt::from_hex("0xFFFFFFFF00000001000000000000000000000000FFFFFFFF"
+                              "FFFFFFFFFFFFFFFC"),
+             BigInt::from_hex("0x5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F6"
+                              "3BCE3C3E27D2604B"),
+             BigInt::from_hex("0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0"
+                              "F4A13945D898C296"),
+             BigInt::from_hex("0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECE"
+                              "CBB6406837BF51F5"),
+             BigInt::from_hex("0xFFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84"
+                              "F3B9CAC2FC632551"),
+             1},
+        };
+        return curves;
+      }
+
+      // Chỉ số của đường cong trong registry(), đã xử lý tên khác
+      size_t curveIndex(const std::string &name) {
+        std::string canonical = name;
+        for (const CurveAlias &alias : kAliases) {
+          if (name == alias.alias) {
+            canonical = alias.name;
+            break;
+          }
+        }
+        const std::vector<CurveParams> &curves = registry();
+        for (size_t i = 0; i < curves.size(); ++i) {
+          if (curves[i].name == canonical) {
+            return i;
+          }
+        }
+        throw std::invalid_argument("Unknown curve: " + name);
+      }
+
+      // Bản mẫu của một đường cong; mỗi đường cong có ô riêng nên chỉ đường
+      // cong được yêu cầu mới phải dựng (Curve<Field>, bảng điểm sinh)
+      struct PrototypeSlot {
+        std::once_flag once;
+        std::unique_ptr<const EllipticCurve> curve;
+      };
+
+      // Bản mẫu của mỗi đường cong, dựng khi được dùng lần đầu
+      const EllipticCurve &prototype(size_t index) {
+        static std::vector<PrototypeSlot> slots(registry().size());
+        PrototypeSlot &slot = slots[index];
+        std::call_once(slot.once, [&slot, index] {
+          slot.curve = std::make_unique<const EllipticCurve>(registry()[index]);
+        });
+        return *slot.curve;
+      }
+    }  // namespace
+
+    const CurveParams &curveParams(const std::string &name) {
+      return registry()[curveIndex(name)];
+    }
+
+    std::vector<std::string> namedCurves() {
+      std::vector<std::string> names;
+      for (const CurveParams &params : registry()) {
+        names.push_back(params.name);
+      }
+      return names;
+    }
+
+    EllipticCurve namedCurve(const std::string &name) {
+      return prototype(curveIndex(name));
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
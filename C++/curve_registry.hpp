@@ -0,0 +1,58 @@
+#ifndef CURVE_REGISTRY_HPP
+#define CURVE_REGISTRY_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bigInt.hpp"
+#include "elliptic_curve.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Tham số chuẩn của một đường cong có tên
+     * @note p là số nguyên tố và n là bậc của G đã được kiểm chứng, nên
+     * EllipticCurve dựng từ CurveParams không chạy kiểm tra Miller-Rabin
+     */
+    struct CurveParams {
+      std::string name;
+      BigInt p;         // Trường hữu hạn Z_p
+      BigInt a;         // Hệ số a
+      BigInt b;         // Hệ số b
+      BigInt gx;        // Hoành độ điểm sinh G
+      BigInt gy;        // Tung độ điểm sinh G
+      BigInt n;         // Bậc của G
+      uint64_t cofactor;  // h = #E / n
+    };
+
+    /*
+     * Hàm tra cứu tham số của đường cong có tên
+     * @param name Tên đường cong ("secp256k1" hoặc "P-256"/"secp256r1")
+     * @return Tham số của đường cong
+     * @throws std::invalid_argument nếu tên không có trong danh sách
+     */
+    const CurveParams &curveParams(const std::string &name);
+
+    /*
+     * Hàm liệt kê tên các đường cong có sẵn
+     * @return Tên chuẩn của các đường cong
+     */
+    std::vector<std::string> namedCurves();
+
+    /*
+     * Hàm tạo đường cong có tên
+     * @param name Tên đường cong (xem curveParams())
+     * @return Đường cong đã đặt điểm sinh G, bậc n và cofactor
+     * @note Mỗi đường cong chỉ được dựng một lần (Curve<Field>, bảng
+     * tiền tính của G với EllipticCurve::kDefaultBaseWindow); các lần gọi
+     * sau chỉ sao chép bản mẫu và dùng chung bảng tiền tính
+     * @throws std::invalid_argument nếu tên không có trong danh sách
+     */
+    EllipticCurve namedCurve(const std::string &name);
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // CURVE_REGISTRY_HPP
@@ -0,0 +1,213 @@
+#include "ecdsa.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <stdexcept>
+
+#include "scalar.hpp"
+#include "utils.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    namespace {
+      // z = số bit bên trái của msgHash, bằng số bit của n, rút gọn mod n
+      Scalar hashToScalar(const ScalarField &field,
+                          const std::vector<uint8_t> &msgHash) {
+        const size_t bits = field.order().bit_length();
+        if (msgHash.size() * 8 <= bits) {
+          return field.fromHash(msgHash);
+        }
+        using Offset = std::vector<uint8_t>::difference_type;
+        std::vector<uint8_t> prefix(
+            msgHash.begin(),
+            msgHash.begin() + static_cast<Offset>((bits + 7) / 8));
+        const size_t shift = prefix.size() * 8 - bits;
+        if (shift != 0) {
+          // Dịch phải cả mảng shift bit (shift < 8)
+          for (size_t i = prefix.size(); i-- > 0;) {
+            uint8_t carry = i > 0
+                ? static_cast<uint8_t>(prefix[i - 1] << (8 - shift))
+                : 0;
+            prefix[i] = static_cast<uint8_t>((prefix[i] >> shift) | carry);
+          }
+        }
+        return field.fromHash(prefix);
+      }
+
+      // Kiểm tra r, s trong [1, n - 1] và Q là điểm hợp lệ trên đường cong
+      bool checkInputs(const EllipticCurve &curve,
+                       const BigInt &n,
+                       const Point &pubkey,
+                       const BigInt &r,
+                       const BigInt &s) {
+        if (r == BigInt(0) || r >= n || s == BigInt(0) || s >= n) {
+          return false;
+        }
+        return !pubkey.isInfinity() && curve.isOnCurve(pubkey);
+      }
+
+      // R = u1 * G + u2 * Q, chữ ký hợp lệ nếu R.x mod n = r
+      bool checkCombination(const EllipticCurve &curve,
+                            const BigInt &n,
+                            const Point &pubkey,
+                            const Scalar &u1,
+                            const Scalar &u2,
+                            const BigInt &r) {
+        Point R =
+            curve.multiplyBaseAndPoint(u1.toBigInt(), pubkey, u2.toBigInt());
+        if (R.isInfinity()) {
+          return false;
+        }
+        return R.x() % n == r;
+      }
+    }  // namespace
+
+    bool ecdsaVerify(const EllipticCurve &curve,
+                     const Point &pubkey,
+                     const std::vector<uint8_t> &msgHash,
+                     const BigInt &r,
+                     const BigInt &s) {
+      const BigInt &n = curve.order();
+      if (n == BigInt(0)) {
+        throw std::invalid_argument("Curve order is unknown");
+      }
+      if (!checkInputs(curve, n, pubkey, r, s)) {
+        return false;
+      }
+
+      const ScalarField &field = curve.scalarField();
+      Scalar w = field.fromBigInt(s).inverse();
+      Scalar u1 = hashToScalar(field, msgHash) * w;
+      Scalar u2 = field.fromBigInt(r) * w;
+      return checkCombination(curve, n, pubkey, u1, u2, r);
+    }
+
+    std::vector<size_t> ecdsaVerifyBatch(
+        const EllipticCurve &curve,
+        const std::vector<EcdsaBatchEntry> &entries) {
+      const BigInt &n = curve.order();
+      if (n == BigInt(0)) {
+        throw std::invalid_argument("Curve order is unknown");
+      }
+      const ScalarField &field = curve.scalarField();
+
+      std::vector<size_t> invalid;
+      std::vector<size_t> pending;
+      std::vector<Scalar> s_values;
+      bool recoverable = true;
+      for (size_t i = 0; i < entries.size(); ++i) {
+        const EcdsaBatchEntry &e = entries[i];
+        if (!checkInputs(curve, n, e.pubkey, e.r, e.s)) {
+          invalid.push_back(i);
+          continue;
+        }
+        pending.push_back(i);
+        s_values.push_back(field.fromBigInt(e.s));
+        recoverable = recoverable && e.recid >= 0 && e.recid <= 3;
+      }
+      if (pending.empty()) {
+        return invalid;
+      }
+
+      std::vector<Scalar> w = batchInverse(s_values);
+      std::vector<Scalar> u1;
+      std::vector<Scalar> u2;
+      u1.reserve(pending.size());
+      u2.reserve(pending.size());
+      for (size_t j = 0; j < pending.size(); ++j) {
+        const EcdsaBatchEntry &e = entries[pending[j]];
+        u1.push_back(hashToScalar(field, e.msgHash) * w[j]);
+        u2.push_back(field.fromBigInt(e.r) * w[j]);
+      }
+
+      // Kiểm tra gộp: sum(a_j * (R_j - u2_j * Q_j)) = (sum a_j * u1_j) * G
+      if (recoverable && pending.size() > 1) {
+        std::vector<Point> points;
+        std::vector<BigInt> scalars;
+        points.reserve(2 * pending.size());
+        scalars.reserve(2 * pending.size());
+        Scalar base = field.zero();
+        for (size_t j = 0; j < pending.size() && recoverable; ++j) {
+          const EcdsaBatchEntry &e = entries[pending[j]];
+          BigInt x = (e.recid & 2) ? e.r + n : e.r;
+          Point R;
+          if (!curve.liftX(x, (e.recid & 1) != 0, R)) {
+            recoverable = false;
+            break;
+          }
+          Scalar a = field.fromBigInt(randomBatchCoefficient(n));
+          base += a * u1[j];
+          points.push_back(R);
+          scalars.push_back(a.toBigInt());
+          points.push_back(e.pubkey);
+          scalars.push_back((-(a * u2[j])).toBigInt());
+        }
+        if (recoverable) {
+          Point left = curve.multiScalarMultiply(points, scalars);
+          Point right = curve.multiplyBase(base.toBigInt());
+          if (samePoint(curve, left, right)) {
+            return invalid;
+          }
+        }
+      }
+
+      // Xác minh riêng từng chữ ký (các nghịch đảo của s đã được tính chung)
+      for (size_t j = 0; j < pending.size(); ++j) {
+        const EcdsaBatchEntry &e = entries[pending[j]];
+        if (!checkCombination(curve, n, e.pubkey, u1[j], u2[j], e.r)) {
+          invalid.push_back(pending[j]);
+        }
+      }
+      std::sort(invalid.begin(), invalid.end());
+      return invalid;
+    }
+
+    bool ecdsaRecover(const EllipticCurve &curve,
+                      const std::vector<uint8_t> &msgHash,
+                      const BigInt &r,
+                      const BigInt &s,
+                      int recid,
+                      Point &pubkey) {
+      const BigInt &n = curve.order();
+      if (n == BigInt(0)) {
+        throw std::invalid_argument("Curve order is unknown");
+      }
+      if (r == BigInt(0) || r >= n || s == BigInt(0) || s >= n || recid < 0
+          || recid > 3) {
+        return false;
+      }
+
+      // R.x = r hoặc r + n, tính chẵn lẻ của R.y nằm trong bit 0 của recid
+      Point R;
+      BigInt x = (recid & 2) ? r + n : r;
+      if (!curve.liftX(x, (recid & 1) != 0, R)) {
+        return false;
+      }
+
+      // Q = (-z / r) * G + (s / r) * R
+      const ScalarField &field = curve.scalarField();
+      Scalar r_inv = field.fromBigInt(r).inverse();
+      Scalar u1 = -(hashToScalar(field, msgHash) * r_inv);
+      Scalar u2 = field.fromBigInt(s) * r_inv;
+      Point Q = curve.multiplyBaseAndPoint(u1.toBigInt(), R, u2.toBigInt());
+      if (Q.isInfinity()) {
+        return false;
+      }
+      pubkey = std::move(Q);
+      return true;
+    }
+
+    int ecdsaRecoveryId(const EllipticCurve &curve, const Point &R) {
+      if (R.isInfinity()) {
+        throw std::invalid_argument("R is the point at infinity");
+      }
+      int recid = R.y().test_bit(0) ? 1 : 0;
+      if (R.x() >= curve.order()) {
+        recid |= 2;
+      }
+      return recid;
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
@@ -0,0 +1,97 @@
+#ifndef ECDSA_HPP
+#define ECDSA_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "bigInt.hpp"
+#include "elliptic_curve.hpp"
+#include "point.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Hàm xác minh chữ ký ECDSA (r, s)
+     * @param curve Đường cong elliptic (đã đặt điểm sinh G và biết bậc n)
+     * @param pubkey Khóa công khai Q
+     * @param msgHash Giá trị băm của thông điệp (big-endian); nếu dài hơn n,
+     * chỉ lấy số bit bên trái bằng số bit của n
+     * @param r Thành phần r của chữ ký
+     * @param s Thành phần s của chữ ký
+     * @return true nếu chữ ký hợp lệ, false nếu không
+     * @note Tính u1 * G + u2 * Q bằng curve.multiplyBaseAndPoint(): u1 * G
+     * dùng bảng tiền tính của G, chỉ u2 * Q cần chuỗi nhân đôi
+     * @throws std::invalid_argument nếu chưa biết bậc của điểm sinh
+     */
+    bool ecdsaVerify(const EllipticCurve &curve,
+                     const Point &pubkey,
+                     const std::vector<uint8_t> &msgHash,
+                     const BigInt &r,
+                     const BigInt &s);
+
+    /*
+     * Một chữ ký ECDSA cần xác minh trong ecdsaVerifyBatch()
+     * @note recid: -1 nếu không biết; nếu biết, bit 0 là tính chẵn lẻ của
+     * R.y và bit 1 cho biết R.x = r + n (thay vì R.x = r)
+     */
+    struct EcdsaBatchEntry {
+      Point pubkey;
+      std::vector<uint8_t> msgHash;
+      BigInt r;
+      BigInt s;
+      int recid = -1;
+    };
+
+    /*
+     * Hàm xác minh nhiều chữ ký ECDSA cùng lúc
+     * @param curve Đường cong elliptic (đã đặt điểm sinh G và biết bậc n)
+     * @param entries Các chữ ký cần xác minh
+     * @return Chỉ số (tăng dần) của các chữ ký không hợp lệ, rỗng nếu tất
+     * cả hợp lệ
+     * @note Các s được nghịch đảo chung bằng một phép nghịch đảo. Nếu mọi
+     * chữ ký đều có recid, R_i được giải nén và cả lô được kiểm tra bằng
+     *   sum(a_i * R_i) = (sum a_i * u1_i) * G + sum(a_i * u2_i * Q_i)
+     * với a_i ngẫu nhiên (tối đa 128 bit): một phép nhân đa vô hướng cộng
+     * một phép nhân điểm sinh dùng bảng tiền tính. Nếu kiểm tra gộp thất
+     * bại hoặc thiếu recid, từng chữ ký được xác minh riêng
+     * @throws std::invalid_argument nếu chưa biết bậc của điểm sinh
+     */
+    std::vector<size_t> ecdsaVerifyBatch(
+        const EllipticCurve &curve,
+        const std::vector<EcdsaBatchEntry> &entries);
+
+    /*
+     * Hàm khôi phục khóa công khai từ chữ ký ECDSA
+     * @param curve Đường cong elliptic (đã đặt điểm sinh G và biết bậc n)
+     * @param msgHash Giá trị băm của thông điệp (như trong ecdsaVerify())
+     * @param r Thành phần r của chữ ký
+     * @param s Thành phần s của chữ ký
+     * @param recid Mã khôi phục trong [0, 3] (xem ecdsaRecoveryId())
+     * @param pubkey Nhận khóa công khai Q nếu khôi phục được
+     * @return false nếu chữ ký hoặc recid không hợp lệ
+     * @note Q = r^-1 * (s * R - z * G): giải nén R từ r và tính chẵn lẻ, rồi
+     * tính chung bằng curve.multiplyBaseAndPoint()
+     * @throws std::invalid_argument nếu chưa biết bậc của điểm sinh
+     */
+    bool ecdsaRecover(const EllipticCurve &curve,
+                      const std::vector<uint8_t> &msgHash,
+                      const BigInt &r,
+                      const BigInt &s,
+                      int recid,
+                      Point &pubkey);
+
+    /*
+     * Hàm tính mã khôi phục cho bước ký
+     * @param curve Đường cong elliptic (biết bậc n)
+     * @param R Điểm nonce k * G của chữ ký (r = R.x mod n)
+     * @return recid: bit 0 là tính chẵn lẻ của R.y, bit 1 bằng 1 nếu R.x >= n
+     * @note Nếu bước ký thay s bằng n - s (chuẩn hóa low-s), cần đảo bit 0
+     * @throws std::invalid_argument nếu R là điểm vô cực
+     */
+    int ecdsaRecoveryId(const EllipticCurve &curve, const Point &R);
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // ECDSA_HPP
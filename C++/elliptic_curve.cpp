@@ -1,22 +1,62 @@
 #include "elliptic_curve.hpp"
+#include "curve.hpp"
+#include "curve_registry.hpp"
+#include "jacobian.hpp"
+#include "modinv.hpp"
 #include "point.hpp"
 #include "utils.hpp"
 #include <stdexcept>
+#include <type_traits>
 
 namespace shared_model {
   namespace crypto {
 
     EllipticCurve::EllipticCurve(BigInt &p, BigInt a, BigInt b) {
-      // p phải là số nguyên tố
+      // p phải là số nguyên tố lẻ
       if (!isPrime(p)) {
         throw std::invalid_argument("p is not prime");
       }
+      if (!p.test_bit(0)) {
+        throw std::invalid_argument("p must be an odd prime");
+      }
       p_ = p;
       a_ = a;
       b_ = b;
       O_ = Point();
       G_ = Point();
       order_ = BigInt() ;
+      cofactor_ = 0;
+      selectBackend();
+    }
+
+    EllipticCurve::EllipticCurve(const CurveParams &params, size_t window)
+        : p_(params.p),
+          a_(params.a),
+          b_(params.b),
+          order_(params.n),
+          cofactor_(params.cofactor) {
+      selectBackend();
+      setGenerator(Point(params.gx, params.gy), window);
+    }
+
+    void EllipticCurve::selectBackend() {
+      secp256k1_ = Secp256k1Field::isModulus(p_) && a_ == BigInt(0)
+          && b_ == BigInt(7);
+      // Công thức a = -3 và rút gọn Solinas không phụ thuộc vào b
+      p256_ = P256Field::isModulus(p_) && a_ == p_ - BigInt(3);
+
+      // FieldOps và Curve được dựng một lần ở đây thay vì ở mỗi phép toán
+      if (secp256k1_) {
+        curve_secp_ = std::make_shared<const Curve<Secp256k1FieldOps>>(
+            Secp256k1FieldOps(), b_);
+      } else if (p256_) {
+        curve_p256_ =
+            std::make_shared<const Curve<P256FieldOps>>(P256FieldOps(), b_);
+      } else {
+        mont_p_ = std::make_shared<const MontgomeryContext>(p_);
+        curve_generic_ = std::make_shared<const Curve<MontgomeryFieldOps>>(
+            MontgomeryFieldOps(*mont_p_, a_), b_);
+      }
     }
 
 
@@ -24,18 +64,58 @@ namespace shared_model {
       if (P.isInfinity()) {
         return true;
       }
-      BigInt x = P.x();
-      BigInt y = P.y();
-      BigInt left = (y * y) % p_;
-      BigInt right = (x * x * x + a_ * x + b_) % p_;
-      return left == right;
+      // Curve<Field> chọn phương trình theo dạng của a khi biên dịch
+      return withCurve([&](const auto &C) { return C.isOnCurve(P); });
     }
 
     BigInt EllipticCurve::inverseMod(BigInt k) const {
       if(k == BigInt(0)) {
         throw std::invalid_argument("k is 0");
       }
-      return pow_mod(k, p_ - BigInt(2), p_);
+      if (secp256k1_) {
+        return Secp256k1Field(k).inverse().toBigInt();
+      }
+      BigInt inverse;
+      if (!tryInverseMod(k, p_, inverse)) {
+        throw std::invalid_argument("k has no inverse modulo p");
+      }
+      return inverse;
+    }
+
+    bool EllipticCurve::liftX(const BigInt &x, bool odd, Point &P) const {
+      if (x >= p_) {
+        return false;
+      }
+      BigInt y;
+      if (secp256k1_) {
+        Secp256k1Field fx(x);
+        Secp256k1Field root;
+        if (!(fx.sqr() * fx + Secp256k1Field(7)).sqrt(root)) {
+          return false;
+        }
+        y = root.toBigInt();
+      } else if (p256_) {
+        P256Field fx(x);
+        P256Field root;
+        P256Field rhs = (fx.sqr() - P256Field(3)) * fx + P256Field(b_);
+        if (!rhs.sqrt(root)) {
+          return false;
+        }
+        y = root.toBigInt();
+      } else {
+        BigInt rhs = (x * x * x + a_ * x + b_) % p_;
+        if (!sqrtMod(rhs, p_, y)) {
+          return false;
+        }
+      }
+      if (y.test_bit(0) != odd) {
+        if (y == BigInt(0)) {
+          return false;
+        }
+        y = negMod(y, p_);
+      }
+      P = Point(x, std::move(y));
+      return true;
     }
 
     bool EllipticCurve::coincide(const Point &P, const Point &Q) const {
@@ -52,29 +132,19 @@ namespace shared_model {
       if (Q.isInfinity()) {
         return P;
       }
-
-      BigInt x1 = P.x();
-      BigInt y1 = P.y();
-      BigInt x2 = Q.x();
-      BigInt y2 = Q.y();
-
-      if(x1 == x2 && y1 != y2) {
-        return O_;
-      }
-      BigInt s;
-      if (coincide(P, Q)) {
-        s = (BigInt(3) * x1 * x1 + a_) * inverseMod(BigInt(2) * y1) % p_;
-      }
-      else {
-        s = (y2 - y1) * inverseMod(x2 - x1) % p_;
-      }
-      BigInt x3 = (s * s - x1 - x2) % p_;
-      BigInt y3 = (s * (x1 - x3) - y1) % p_;
-
-      return Point(x3, y3);
+      // Cộng hỗn hợp ở tọa độ Jacobian rồi chuyển về affine: đúng một phép
+      // nghịch đảo, và phép trừ trên trường không bao giờ âm
+      return withCurve([&](const auto &C) {
+        const auto &F = C.field();
+        auto R = C.addMixed(toJacobian(F, toFieldAffine(F, P)),
+                            toFieldAffine(F, Q));
+        return toAffinePoint(F, R);
+      });
     }
 
-    Point EllipticCurve::multiply(const Point &P, BigInt k) const {
+    Point EllipticCurve::multiply(const Point &P,
+                                  BigInt k,
+                                  size_t window) const {
       if (P.isInfinity()) {
         return O_;
       }
@@ -84,16 +154,47 @@ namespace shared_model {
       if(order_ != BigInt(0)){
         k = k % order_;
       }
-      Point R = O_;
-      Point Q = P;
-      while (k > BigInt(0)) {
-        if (k % BigInt(2) == BigInt(1)) {
-          R = add(R, Q);
-        }
-        Q = add(Q, Q);
-        k = k / BigInt(2);
+      if (secp256k1_) {
+        return multiplyGlv(P, k, window);
+      }
+      // wNAF ở tọa độ Jacobian, chỉ chuyển về affine một lần ở cuối
+      return withCurve([&](const auto &C) {
+        const auto &F = C.field();
+        return toAffinePoint(F, C.multiply(toFieldAffine(F, P), k, window));
+      });
+    }
+
+    Point EllipticCurve::multiplyGlv(const Point &P,
+                                     const BigInt &k,
+                                     size_t window) const {
+      Secp256k1FieldOps F;
+      std::vector<AffinePoint<Secp256k1FieldOps>> points;
+      std::vector<BigInt> scalars;
+      appendTerm(F, P, k, points, scalars);
+      return toAffinePoint(F, straussMultiply(F, points, scalars, window));
+    }
+
+    void EllipticCurve::appendTerm(
+        const Secp256k1FieldOps &F,
+        const Point &P,
+        const BigInt &k,
+        std::vector<AffinePoint<Secp256k1FieldOps>> &points,
+        std::vector<BigInt> &scalars) const {
+      // k * P = k1 * P + k2 * phi(P), phi(x, y) = (beta * x, y)
+      GlvSplit split = splitScalarSecp256k1(k);
+      AffinePoint<Secp256k1FieldOps> P1 = toFieldAffine(F, P);
+      AffinePoint<Secp256k1FieldOps> P2 = {
+          P1.x * secp256k1Beta(), P1.y, P1.infinity};
+      if (split.k1_negative) {
+        P1.y = -P1.y;
       }
-      return R;
+      if (split.k2_negative) {
+        P2.y = -P2.y;
+      }
+      points.push_back(P1);
+      scalars.push_back(split.k1);
+      points.push_back(P2);
+      scalars.push_back(split.k2);
     }
 
     Point EllipticCurve::findGenerator() {
@@ -105,9 +206,10 @@ namespace shared_model {
           if (isOnCurve(P)) {
             BigInt order = findOrder(P);
             if(isPrime(order)) {
-              // Nếu order là số nguyên tố, thì P là điểm sinh
-              G_ = P;
+              // Nếu order là số nguyên tố, thì P là điểm sinh; setGenerator()
+              // dựng lại bảng tiền tính của multiplyBase() cho P
               order_ = order;
+              setGenerator(P);
               return P;
             }
           }
@@ -115,11 +217,88 @@ namespace shared_model {
       }
       throw std::runtime_error("No generator point found");
     }
-    void EllipticCurve::setGenerator(const Point &G) {
+    void EllipticCurve::setGenerator(const Point &G, size_t window) {
       if (!isOnCurve(G)) {
         throw std::invalid_argument("G is not on the curve");
       }
+      if (window > FixedBaseTable<Secp256k1FieldOps>::kMaxWindow) {
+        throw std::invalid_argument("Invalid fixed-base window");
+      }
       G_ = G;
+      if (secp256k1_ && !G.isInfinity()) {
+        // Cofactor bằng 1: mọi điểm khác vô cực đều có bậc n
+        order_ = secp256k1Order();
+        cofactor_ = 1;
+      }
+      // Hằng số Barrett của n được tính một lần ở đây thay vì ở mỗi chữ ký
+      if (order_ >= BigInt(2) && order_.bit_length() <= 256) {
+        scalar_field_ = std::make_shared<const ScalarField>(order_);
+      } else {
+        scalar_field_.reset();
+      }
+      base_table_secp_.reset();
+      base_table_p256_.reset();
+      base_table_generic_.reset();
+      if (window == 0 || G.isInfinity()) {
+        return;
+      }
+
+      // Số nhân được rút gọn mod order_ nếu đã biết bậc; nếu chưa, bậc không
+      // vượt quá 2p + 1 (định lý Hasse)
+      size_t bits = order_ != BigInt(0) ? order_.bit_length()
+                                        : p_.bit_length() + 1;
+      if (secp256k1_) {
+        base_table_secp_ =
+            std::make_shared<const FixedBaseTable<Secp256k1FieldOps>>(
+                Secp256k1FieldOps(), G_, window, bits);
+      } else if (p256_) {
+        base_table_p256_ =
+            std::make_shared<const FixedBaseTable<P256FieldOps>>(
+                P256FieldOps(), G_, window, bits);
+      } else {
+        base_table_generic_ =
+            std::make_shared<const FixedBaseTable<MontgomeryFieldOps>>(
+                curve_generic_->field(), G_, window, bits);
+      }
+    }
+
+    Point EllipticCurve::multiplyBase(BigInt k) const {
+      if(order_ != BigInt(0)){
+        k = k % order_;
+      }
+      return withField([&](const auto &F) {
+        const auto *table = baseTable(F);
+        if (table == nullptr || k.bit_length() > table->bits()) {
+          return multiply(G_, k);
+        }
+        return toAffinePoint(F, table->multiply(F, k));
+      });
+    }
+
+    Point EllipticCurve::multiplyBaseAndPoint(BigInt k,
+                                              const Point &P,
+                                              BigInt l) const {
+      if(order_ != BigInt(0)){
+        k = k % order_;
+        l = l % order_;
+      }
+      return withCurve([&](const auto &C) {
+        const auto &F = C.field();
+        using Field = std::decay_t<decltype(F)>;
+        std::vector<AffinePoint<Field>> points;
+        std::vector<BigInt> scalars;
+        appendTerm(F, P, l, points, scalars);
+        const auto *table = baseTable(F);
+        if (table == nullptr || k.bit_length() > table->bits()) {
+          appendTerm(F, G_, k, points, scalars);
+          return toAffinePoint(
+              F, straussMultiply(F, points, scalars, kDefaultWnafWindow));
+        }
+        return toAffinePoint(
+            F,
+            C.add(table->multiply(F, k),
+                  straussMultiply(F, points, scalars, kDefaultWnafWindow)));
+      });
     }
 
     bool EllipticCurve::isGenerator(const Point &P) const {
@@ -135,19 +314,44 @@ namespace shared_model {
       while (!Q.isInfinity()) {
         Q = add(Q, P);
         order = order + BigInt(1);
-        if (order > p_ + BigInt(1)) {
+        // Định lý Hasse: bậc không vượt quá p + 1 + 2 * sqrt(p) <= 2p + 1
+        if (order > p_ + p_ + BigInt(1)) {
           throw std::runtime_error("Exceeded iteration limit when computing order");
         }
       }
       return order;
     }
 
-    Point EllipticCurve::sumPoints(const std::vector<Point> &points) const {
-      Point result = O_;
-      for (const auto &point : points) {
-        result = add(result, point);
+    Point EllipticCurve::multiScalarMultiply(
+        const std::vector<Point> &points,
+        const std::vector<BigInt> &scalars) const {
+      if (points.size() != scalars.size()) {
+        throw std::invalid_argument("points and scalars differ in size");
       }
-      return result;
+      return withField([&](const auto &F) {
+        using Field = std::decay_t<decltype(F)>;
+        std::vector<AffinePoint<Field>> terms;
+        std::vector<BigInt> multipliers;
+        terms.reserve(2 * points.size());
+        multipliers.reserve(2 * points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+          appendTerm(F, points[i], scalars[i], terms, multipliers);
+        }
+        return toAffinePoint(
+            F, crypto::multiScalarMultiply(F, terms, multipliers));
+      });
+    }
+
+    Point EllipticCurve::sumPoints(const std::vector<Point> &points) const {
+      // Cộng dồn ở tọa độ Jacobian, chỉ một phép nghịch đảo ở cuối
+      return withCurve([&](const auto &C) {
+        const auto &F = C.field();
+        auto R = jacobianInfinity(F);
+        for (const auto &point : points) {
+          R = C.addMixed(R, toFieldAffine(F, point));
+        }
+        return toAffinePoint(F, R);
+      });
     }
 
 
@@ -2,52 +2,104 @@
 #define IROHA_ELLIPTIC_CURVE_HPP
 
 #include <cstdint>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 #include "point.hpp"
 #include "bigInt.hpp"
+#include "curve.hpp"
+#include "field_ops.hpp"
+#include "fixed_base.hpp"
+#include "montgomery.hpp"
+#include "msm.hpp"
+#include "scalar.hpp"
+#include "secp256k1_field.hpp"
+#include "secp256k1_glv.hpp"
 #include "utils.hpp"
+#include "wnaf.hpp"
 
 namespace shared_model {
   namespace crypto {
 
+    struct CurveParams;
+
     // Lớp đại diện cho đường cong elliptic
     class EllipticCurve {
      public:
+      // Độ rộng cửa sổ mặc định của bảng điểm sinh
+      static constexpr size_t kDefaultBaseWindow = 4;
+
+      // Độ rộng cửa sổ wNAF mặc định của multiply()
+      static constexpr size_t kDefaultWnafWindow = 5;
+
      /*
       * Constructor cho đường cong elliptic
       * @param p Trường hữu hạn Z_p
       * @param a Hệ số a
       * @param b Hệ số b
       * @note Đường cong elliptic được định nghĩa bởi phương trình y^2 = x^3 + ax + b mod p
-      * @note p phải là số nguyên tố
-      * @throws std::invalid_argument nếu p không phải là số nguyên tố
+      * @note p phải là số nguyên tố lẻ
+      * @throws std::invalid_argument nếu p không phải là số nguyên tố lẻ
+      * @note Nếu (p, a, b) là tham số của secp256k1, các phép toán trên trường
+      * tự động dùng Secp256k1Field; nếu p là số nguyên tố của P-256 và
+      * a = -3, dùng P256Field
      */
       EllipticCurve(BigInt &p, BigInt a, BigInt b);
+
+     /*
+      * Constructor cho đường cong có tên (xem curve_registry.hpp)
+      * @param params Tham số chuẩn đã được kiểm chứng: bỏ qua kiểm tra tính
+      * nguyên tố của p, đặt sẵn điểm sinh G, bậc n và cofactor
+      * @param window Độ rộng cửa sổ của bảng tiền tính cho multiplyBase()
+      * @note Nên dùng namedCurve() để dùng chung bản mẫu đã dựng sẵn
+      */
+      explicit EllipticCurve(const CurveParams &params,
+                             size_t window = kDefaultBaseWindow);
       ~EllipticCurve() = default;
 
       // lấy giá trị a và b
-      BigInt a() const {
+      const BigInt &a() const {
         return a_;
       }
-      BigInt b() const {
+      const BigInt &b() const {
         return b_;
       }
 
-      Point O() const {
+      const Point &O() const {
         return O_;
       }
-      Point G() const {
+      const Point &G() const {
         return G_;
       }
-      BigInt p() const {
+      const BigInt &p() const {
         return p_;
       }
 
-      BigInt order() const {
+      const BigInt &order() const {
         return order_;
       }
 
+      /*
+      * Trường Z_n của bậc điểm sinh, dựng một lần trong setGenerator() và
+      * dùng chung giữa các bản sao của đường cong
+      * @throws std::invalid_argument nếu chưa biết bậc hoặc bậc không nằm
+      * trong [2, 2^256)
+      */
+      const ScalarField &scalarField() const {
+        if (!scalar_field_) {
+          throw std::invalid_argument(
+              order_ == BigInt(0) ? "Curve order is unknown"
+                                  : "Scalar order must be in [2, 2^256)");
+        }
+        return *scalar_field_;
+      }
+
+      // Cofactor h = #E / n, bằng 0 nếu chưa biết
+      uint64_t cofactor() const {
+        return cofactor_;
+      }
+
       /*
       * Hàm kiểm tra xem một điểm có nằm trên đường cong elliptic hay không
       * @param P Điểm cần kiểm tra
@@ -65,6 +117,18 @@ namespace shared_model {
       */
       BigInt inverseMod(BigInt k) const;
 
+      /*
+      * Hàm tìm điểm trên đường cong có hoành độ x (giải nén điểm)
+      * @param x Hoành độ, x < p
+      * @param odd true nếu cần tung độ lẻ, false nếu cần tung độ chẵn
+      * @param P Nhận điểm (x, y) nếu tồn tại
+      * @return false nếu không có điểm nào có hoành độ x và tính chẵn lẻ
+      * tương ứng
+      * @note Với secp256k1 và P-256 dùng sqrt() của trường chuyên biệt, các
+      * đường cong khác dùng sqrtMod()
+      */
+      bool liftX(const BigInt &x, bool odd, Point &P) const;
+
       /*
       * Hàm kiểm tra xem hai điểm có trùng nhau hay không
       * @param P Điểm thứ nhất
@@ -91,8 +155,14 @@ namespace shared_model {
       * @note Nếu k = 0, hàm sẽ trả về điểm vô cực
       * @note Nếu k < 0, hàm sẽ ném ra ngoại lệ std::invalid_argument
       * @note Nếu k > 0, hàm sẽ trả về điểm P nhân với k
+      * @param window Độ rộng cửa sổ wNAF, trong [2, 8]
+      * @throws std::invalid_argument nếu window không hợp lệ
+      * @note Với secp256k1, k được tách theo GLV thành hai số nhân khoảng
+      * 128 bit và tính chung một chuỗi nhân đôi
       */
-      Point multiply(const Point &P, BigInt k) const;
+      Point multiply(const Point &P,
+                     BigInt k,
+                     size_t window = kDefaultWnafWindow) const;
 
       /*
       * Hàm tìm điểm sinh của đường cong elliptic
@@ -110,8 +180,50 @@ namespace shared_model {
       bool isGenerator(const Point &P) const;
       /*
       * Hàm thiết lập điểm sinh của đường cong
+      * @param P Điểm sinh
+      * @param window Độ rộng cửa sổ của bảng tiền tính cho multiplyBase()
+      * @note window = 0 thì không dựng bảng; window lớn hơn thì multiplyBase()
+      * nhanh hơn nhưng bảng tốn bộ nhớ hơn (xem FixedBaseTable)
+      * @note Với secp256k1 (cofactor 1), bậc của điểm sinh được đặt là n
+      * @throws std::invalid_argument nếu P không nằm trên đường cong hoặc
+      * window > FixedBaseTable::kMaxWindow
+      */
+      void setGenerator(const Point &P,
+                        size_t window = kDefaultBaseWindow);
+
+      /*
+      * Hàm nhân điểm sinh G với số nguyên k, dùng bảng tiền tính nếu có
+      * @param k Số nguyên cần nhân
+      * @return k * G
+      * @note Cho kết quả giống multiply(G(), k)
+      */
+      Point multiplyBase(BigInt k) const;
+
+      /*
+      * Hàm tính k * G + l * P
+      * @param k Số nhân của điểm sinh G
+      * @param P Điểm thứ hai
+      * @param l Số nhân của P
+      * @return k * G + l * P
+      * @note k * G dùng bảng tiền tính nếu có, l * P dùng wNAF (GLV với
+      * secp256k1); hai phần được cộng ở tọa độ Jacobian nên chỉ cần một phép
+      * nghịch đảo. Nếu không có bảng, cả hai dùng chung một chuỗi nhân đôi
+      */
+      Point multiplyBaseAndPoint(BigInt k, const Point &P, BigInt l) const;
+
+
+
+      /*
+      * Hàm nhân đa vô hướng: tính tổng scalars[i] * points[i]
+      * @param points Danh sách các điểm
+      * @param scalars Danh sách các số nhân không âm, cùng kích thước
+      * @return Tổng scalars[i] * points[i]
+      * @note Mọi số hạng dùng chung một chuỗi nhân đôi (Strauss với ít điểm,
+      * Pippenger với nhiều điểm, xem msm.hpp) và chỉ một phép nghịch đảo
+      * @throws std::invalid_argument nếu points và scalars khác kích thước
       */
-      void setGenerator(const Point &P);
+      Point multiScalarMultiply(const std::vector<Point> &points,
+                                const std::vector<BigInt> &scalars) const;
 
       /*
       * Hàm cộng một danh sách các điểm trên đường cong
@@ -120,13 +232,112 @@ namespace shared_model {
       */
       Point sumPoints(const std::vector<Point> &points) const;
 
+      /*
+      * Kiểm tra xem đường cong có phải là secp256k1 hay không
+      * @return true nếu đường cong dùng Secp256k1Field
+      */
+      bool isSecp256k1() const {
+        return secp256k1_;
+      }
+
+      /*
+      * Kiểm tra xem đường cong có dùng trường của P-256 (a = -3) hay không
+      * @return true nếu đường cong dùng P256Field
+      */
+      bool isP256() const {
+        return p256_;
+      }
+
      private:
+      // Chọn backend của trường theo (p, a, b): secp256k1, P-256 hoặc tổng quát
+      void selectBackend();
+
+      // Phép nhân điểm dùng endomorphism GLV của secp256k1
+      Point multiplyGlv(const Point &P, const BigInt &k, size_t window) const;
+
+      /*
+      * Thêm số hạng k * P vào danh sách đầu vào của phép nhân đa vô hướng;
+      * với secp256k1, k được tách theo GLV thành hai số hạng khoảng 128 bit
+      */
+      void appendTerm(const Secp256k1FieldOps &F,
+                      const Point &P,
+                      const BigInt &k,
+                      std::vector<AffinePoint<Secp256k1FieldOps>> &points,
+                      std::vector<BigInt> &scalars) const;
+      template <class Field>
+      void appendTerm(const Field &F,
+                      const Point &P,
+                      const BigInt &k,
+                      std::vector<AffinePoint<Field>> &points,
+                      std::vector<BigInt> &scalars) const {
+        points.push_back(toFieldAffine(F, P));
+        scalars.push_back(order_ != BigInt(0) ? k % order_ : k);
+      }
+
+      // Bảng tiền tính của điểm sinh cho backend tương ứng (nullptr nếu không có)
+      const FixedBaseTable<Secp256k1FieldOps> *baseTable(
+          const Secp256k1FieldOps &) const {
+        return base_table_secp_.get();
+      }
+      const FixedBaseTable<P256FieldOps> *baseTable(
+          const P256FieldOps &) const {
+        return base_table_p256_.get();
+      }
+      const FixedBaseTable<MontgomeryFieldOps> *baseTable(
+          const MontgomeryFieldOps &) const {
+        return base_table_generic_.get();
+      }
+
+      /*
+      * Gọi fn với Curve<Field> của backend đã chọn (Secp256k1FieldOps,
+      * P256FieldOps hoặc MontgomeryFieldOps), để các phép toán điểm dùng công
+      * thức được chọn theo dạng của a khi biên dịch
+      * @note Curve được dựng một lần trong selectBackend(), không tốn phép
+      * nhân Montgomery hay cấp phát nào cho mỗi lời gọi
+      */
+      template <class Fn>
+      auto withCurve(Fn &&fn) const {
+        if (secp256k1_) {
+          return fn(*curve_secp_);
+        }
+        if (p256_) {
+          return fn(*curve_p256_);
+        }
+        return fn(*curve_generic_);
+      }
+
+      /*
+      * Gọi fn với FieldOps của withCurve(), để các công thức Jacobian chỉ
+      * viết một lần
+      */
+      template <class Fn>
+      auto withField(Fn &&fn) const {
+        return withCurve([&](const auto &C) { return fn(C.field()); });
+      }
+
       BigInt p_;      // Trường hữu hạn Z_p
       BigInt a_;      // Hệ số a
       BigInt b_;      // Hệ số b
       Point O_;         // Điểm vô cực
       Point G_;         // Điểm sinh
       BigInt order_;  // Bậc của điểm sinh
+      uint64_t cofactor_;  // Cofactor, 0 nếu chưa biết
+      // Z_n của order_, null nếu chưa biết bậc hoặc ScalarField không nhận
+      std::shared_ptr<const ScalarField> scalar_field_;
+      // Ngữ cảnh Montgomery mod p, chỉ có với backend tổng quát
+      std::shared_ptr<const MontgomeryContext> mont_p_;
+      bool secp256k1_;  // true nếu (p, a, b) là tham số của secp256k1
+      bool p256_;       // true nếu p là số nguyên tố của P-256 và a = -3
+      // Curve<Field> của backend đã chọn, dùng chung giữa các bản sao của
+      // đường cong (Curve<MontgomeryFieldOps> trỏ tới *mont_p_)
+      std::shared_ptr<const Curve<Secp256k1FieldOps>> curve_secp_;
+      std::shared_ptr<const Curve<P256FieldOps>> curve_p256_;
+      std::shared_ptr<const Curve<MontgomeryFieldOps>> curve_generic_;
+      // Bảng tiền tính của điểm sinh, dùng chung giữa các bản sao của đường cong
+      std::shared_ptr<const FixedBaseTable<Secp256k1FieldOps>> base_table_secp_;
+      std::shared_ptr<const FixedBaseTable<P256FieldOps>> base_table_p256_;
+      std::shared_ptr<const FixedBaseTable<MontgomeryFieldOps>>
+          base_table_generic_;
     };
 
   }  // namespace crypto
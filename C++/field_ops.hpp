@@ -0,0 +1,278 @@
+#ifndef FIELD_OPS_HPP
+#define FIELD_OPS_HPP
+
+#include <vector>
+
+#include "bigInt.hpp"
+#include "modinv.hpp"
+#include "montgomery.hpp"
+#include "p256_field.hpp"
+#include "secp256k1_field.hpp"
+#include "utils.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Các lớp FieldOps cung cấp cùng một tập phép toán trên trường Z_p để
+     * các công thức điểm (jacobian.hpp) được viết một lần cho mọi đường cong:
+     *   Element, zero(), one(), add(), sub(), neg(), mul(), sqr(), inv(),
+     *   isZero(), eq(), fromBigInt(), toBigInt(), aIsZero(), a()
+     * cùng lớp rút gọn lười Wide, mulWide(), addWide(), reduce(): cộng dồn
+     * các tích chưa rút gọn rồi rút gọn một lần,
+     * và hằng kCoefficientA cho biết dạng của a tại thời điểm biên dịch
+     * @note Mọi phép toán đều tự rút gọn mod p, không ném ngoại lệ khi hiệu
+     * âm
+     */
+
+    /*
+     * Dạng của hệ số a, dùng để chọn công thức nhân đôi và kiểm tra điểm rẻ
+     * nhất khi biên dịch (xem Curve và jacobianDouble())
+     * @note kGeneric: a chỉ biết lúc chạy (aIsZero(), a())
+     */
+    enum class CoefficientA { kGeneric, kZero, kMinusThree };
+
+    /*
+     * FieldOps cho secp256k1, dùng Secp256k1Field (a = 0)
+     */
+    struct Secp256k1FieldOps {
+      using Element = Secp256k1Field;
+      static constexpr CoefficientA kCoefficientA = CoefficientA::kZero;
+
+      Element zero() const {
+        return Element();
+      }
+      Element one() const {
+        return Element(1);
+      }
+      Element add(const Element &x, const Element &y) const {
+        return x + y;
+      }
+      Element sub(const Element &x, const Element &y) const {
+        return x - y;
+      }
+      Element neg(const Element &x) const {
+        return -x;
+      }
+      Element mul(const Element &x, const Element &y) const {
+        return x * y;
+      }
+      Element sqr(const Element &x) const {
+        return x.sqr();
+      }
+      Element inv(const Element &x) const {
+        return x.inverse();
+      }
+      bool isZero(const Element &x) const {
+        return x.isZero();
+      }
+      bool eq(const Element &x, const Element &y) const {
+        return x == y;
+      }
+      Element fromBigInt(const BigInt &v) const {
+        return Element(v);
+      }
+      BigInt toBigInt(const Element &x) const {
+        return x.toBigInt();
+      }
+      bool aIsZero() const {
+        return true;
+      }
+      const Element &a() const {
+        static const Element kA;
+        return kA;
+      }
+      using Wide = WideSum;
+      Wide mulWide(const Element &x, const Element &y) const {
+        return Element::mulUnreduced(x, y);
+      }
+      void addWide(Wide &acc, const Wide &x) const {
+        acc.add(x);
+      }
+      Element reduce(const Wide &x) const {
+        return Element::reduceWide(x);
+      }
+    };
+
+    /*
+     * FieldOps cho NIST P-256, dùng P256Field (a = -3, rút gọn Solinas)
+     */
+    struct P256FieldOps {
+      using Element = P256Field;
+      static constexpr CoefficientA kCoefficientA = CoefficientA::kMinusThree;
+
+      Element zero() const {
+        return Element();
+      }
+      Element one() const {
+        return Element(1);
+      }
+      Element add(const Element &x, const Element &y) const {
+        return x + y;
+      }
+      Element sub(const Element &x, const Element &y) const {
+        return x - y;
+      }
+      Element neg(const Element &x) const {
+        return -x;
+      }
+      Element mul(const Element &x, const Element &y) const {
+        return x * y;
+      }
+      Element sqr(const Element &x) const {
+        return x.sqr();
+      }
+      Element inv(const Element &x) const {
+        return x.inverse();
+      }
+      bool isZero(const Element &x) const {
+        return x.isZero();
+      }
+      bool eq(const Element &x, const Element &y) const {
+        return x == y;
+      }
+      Element fromBigInt(const BigInt &v) const {
+        return Element(v);
+      }
+      BigInt toBigInt(const Element &x) const {
+        return x.toBigInt();
+      }
+      bool aIsZero() const {
+        return false;
+      }
+      const Element &a() const {
+        static const Element kA = -Element(3);
+        return kA;
+      }
+      using Wide = WideSum;
+      Wide mulWide(const Element &x, const Element &y) const {
+        return Element::mulUnreduced(x, y);
+      }
+      void addWide(Wide &acc, const Wide &x) const {
+        acc.add(x);
+      }
+      Element reduce(const Wide &x) const {
+        return Element::reduceWide(x);
+      }
+    };
+
+    /*
+     * FieldOps tổng quát cho mọi p lẻ, phần tử là BigInt ở dạng Montgomery
+     */
+    class MontgomeryFieldOps {
+     public:
+      using Element = BigInt;
+      static constexpr CoefficientA kCoefficientA = CoefficientA::kGeneric;
+
+      /*
+       * @param ctx Ngữ cảnh Montgomery mod p (phải tồn tại lâu hơn đối tượng)
+       * @param a Hệ số a của đường cong (dạng thường)
+       */
+      MontgomeryFieldOps(const MontgomeryContext &ctx, const BigInt &a)
+          : ctx_(&ctx), a_(ctx.toMontgomery(a)), a_is_zero_(a_ == BigInt(0)) {}
+
+      Element zero() const {
+        return BigInt(0);
+      }
+      Element one() const {
+        return ctx_->one();
+      }
+      Element add(const Element &x, const Element &y) const {
+        return addMod(x, y, ctx_->modulus());
+      }
+      Element sub(const Element &x, const Element &y) const {
+        return subMod(x, y, ctx_->modulus());
+      }
+      Element neg(const Element &x) const {
+        return negMod(x, ctx_->modulus());
+      }
+      Element mul(const Element &x, const Element &y) const {
+        return ctx_->mul(x, y);
+      }
+      Element sqr(const Element &x) const {
+        return ctx_->sqr(x);
+      }
+      // Mỗi tích đã được rút gọn Montgomery, nên Wide chỉ là Element
+      using Wide = Element;
+      Wide mulWide(const Element &x, const Element &y) const {
+        return mul(x, y);
+      }
+      void addWide(Wide &acc, const Wide &x) const {
+        acc = add(acc, x);
+      }
+      Element reduce(const Wide &x) const {
+        return x;
+      }
+      Element inv(const Element &x) const {
+        if (x == BigInt(0)) {
+          throw std::invalid_argument("k is 0");
+        }
+        // (xR)^-1 * R = x^-1 * R
+        BigInt inverse;
+        if (!tryInverseMod(ctx_->fromMontgomery(x), ctx_->modulus(), inverse)) {
+          throw std::invalid_argument("k has no inverse modulo p");
+        }
+        return ctx_->toMontgomery(inverse);
+      }
+      bool isZero(const Element &x) const {
+        return x == BigInt(0);
+      }
+      bool eq(const Element &x, const Element &y) const {
+        return x == y;
+      }
+      Element fromBigInt(const BigInt &v) const {
+        return ctx_->toMontgomery(v);
+      }
+      BigInt toBigInt(const Element &x) const {
+        return ctx_->fromMontgomery(x);
+      }
+      bool aIsZero() const {
+        return a_is_zero_;
+      }
+      const Element &a() const {
+        return a_;
+      }
+
+     private:
+      const MontgomeryContext *ctx_;
+      BigInt a_;  // Hệ số a ở dạng Montgomery
+      bool a_is_zero_;
+    };
+
+    /*
+     * Hàm nghịch đảo nhiều phần tử của trường cùng lúc (Montgomery's trick)
+     * @param F FieldOps của trường
+     * @param values Các phần tử khác 0
+     * @return values[i]^-1 theo đúng thứ tự
+     * @note Chỉ một lần F.inv() cộng 3(k - 1) phép nhân cho k phần tử
+     * @throws std::invalid_argument nếu có phần tử bằng 0
+     */
+    template <class Field>
+    std::vector<typename Field::Element> batchInverse(
+        const Field &F, const std::vector<typename Field::Element> &values) {
+      using Element = typename Field::Element;
+      if (values.empty()) {
+        return {};
+      }
+      // prefix[i] = values[0] * ... * values[i]
+      std::vector<Element> prefix;
+      prefix.reserve(values.size());
+      prefix.push_back(values[0]);
+      for (size_t i = 1; i < values.size(); ++i) {
+        prefix.push_back(F.mul(prefix.back(), values[i]));
+      }
+
+      std::vector<Element> result(values.size());
+      Element inv = F.inv(prefix.back());
+      for (size_t i = values.size(); i-- > 1;) {
+        result[i] = F.mul(inv, prefix[i - 1]);
+        inv = F.mul(inv, values[i]);
+      }
+      result[0] = inv;
+      return result;
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // FIELD_OPS_HPP
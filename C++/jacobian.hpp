@@ -0,0 +1,279 @@
+#ifndef JACOBIAN_HPP
+#define JACOBIAN_HPP
+
+#include <vector>
+
+#include "bigInt.hpp"
+#include "field_ops.hpp"
+#include "point.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Điểm ở tọa độ affine với phần tử của trường Field::Element
+     * @note Dùng làm đầu vào cho phép cộng hỗn hợp (Z = 1)
+     */
+    template <class Field>
+    struct AffinePoint {
+      typename Field::Element x;
+      typename Field::Element y;
+      bool infinity;
+    };
+
+    /*
+     * Điểm ở tọa độ Jacobian: (X, Y, Z) biểu diễn (X / Z^2, Y / Z^3)
+     * @note Z = 0 biểu diễn điểm vô cực
+     * @note Các phép cộng và nhân đôi không cần phép nghịch đảo nào
+     */
+    template <class Field>
+    struct JacobianPoint {
+      typename Field::Element X;
+      typename Field::Element Y;
+      typename Field::Element Z;
+    };
+
+    template <class Field>
+    JacobianPoint<Field> jacobianInfinity(const Field &F) {
+      return {F.one(), F.one(), F.zero()};
+    }
+
+    template <class Field>
+    bool jacobianIsInfinity(const Field &F, const JacobianPoint<Field> &P) {
+      return F.isZero(P.Z);
+    }
+
+    /*
+     * Hàm chuyển Point (affine, BigInt) sang AffinePoint trên trường Field
+     */
+    template <class Field>
+    AffinePoint<Field> toFieldAffine(const Field &F, const Point &P) {
+      if (P.isInfinity()) {
+        return {F.zero(), F.zero(), true};
+      }
+      return {F.fromBigInt(P.x()), F.fromBigInt(P.y()), false};
+    }
+
+    template <class Field>
+    JacobianPoint<Field> toJacobian(const Field &F,
+                                    const AffinePoint<Field> &P) {
+      if (P.infinity) {
+        return jacobianInfinity(F);
+      }
+      return {P.x, P.y, F.one()};
+    }
+
+    /*
+     * Hàm chuyển điểm Jacobian về Point affine, cần đúng một phép nghịch đảo
+     */
+    template <class Field>
+    Point toAffinePoint(const Field &F, const JacobianPoint<Field> &P) {
+      if (jacobianIsInfinity(F, P)) {
+        return Point();
+      }
+      typename Field::Element z_inv = F.inv(P.Z);
+      typename Field::Element z_inv2 = F.sqr(z_inv);
+      typename Field::Element x = F.mul(P.X, z_inv2);
+      typename Field::Element y = F.mul(P.Y, F.mul(z_inv2, z_inv));
+      return Point(F.toBigInt(x), F.toBigInt(y));
+    }
+
+    /*
+     * Hàm chuyển nhiều điểm Jacobian về affine với một phép nghịch đảo chung
+     * @param F FieldOps của đường cong
+     * @param points Các điểm Jacobian (có thể có điểm vô cực)
+     * @return Các điểm affine theo đúng thứ tự
+     * @note Dùng batchInverse() cho các Z khác 0
+     */
+    template <class Field>
+    std::vector<AffinePoint<Field>> toAffineBatch(
+        const Field &F, const std::vector<JacobianPoint<Field>> &points) {
+      using Element = typename Field::Element;
+      std::vector<Element> zs;
+      zs.reserve(points.size());
+      for (const auto &P : points) {
+        if (!jacobianIsInfinity(F, P)) {
+          zs.push_back(P.Z);
+        }
+      }
+      std::vector<Element> z_invs = batchInverse(F, zs);
+
+      std::vector<AffinePoint<Field>> result;
+      result.reserve(points.size());
+      size_t k = 0;
+      for (const auto &P : points) {
+        if (jacobianIsInfinity(F, P)) {
+          result.push_back({F.zero(), F.zero(), true});
+          continue;
+        }
+        const Element &z_inv = z_invs[k++];
+        Element z_inv2 = F.sqr(z_inv);
+        result.push_back({F.mul(P.X, z_inv2),
+                          F.mul(P.Y, F.mul(z_inv2, z_inv)),
+                          false});
+      }
+      return result;
+    }
+
+    /*
+     * Hàm nhân đôi điểm Jacobian (dbl-2007-bl)
+     * @note Số hạng a * Z^4 được chọn theo Field::kCoefficientA khi biên dịch:
+     * a = 0 bỏ hẳn, a = -3 dùng M = 3 * (X - ZZ) * (X + ZZ) (một phép nhân
+     * thay cho một phép bình phương và một phép nhân), còn lại kiểm tra
+     * aIsZero() lúc chạy
+     * @note Y3 = M * (S - X3) - 8 * YY^2 và M tổng quát = X * 3X + a * ZZ^2
+     * được cộng dồn ở dạng chưa rút gọn rồi rút gọn một lần; vì vậy
+     * S = 4 * X * YY được tính bằng một phép nhân thay vì qua YYYY
+     */
+    template <class Field>
+    JacobianPoint<Field> jacobianDouble(const Field &F,
+                                        const JacobianPoint<Field> &P) {
+      using Element = typename Field::Element;
+      using Wide = typename Field::Wide;
+      if (jacobianIsInfinity(F, P) || F.isZero(P.Y)) {
+        return jacobianInfinity(F);
+      }
+      Element yy = F.sqr(P.Y);
+      Element zz = F.sqr(P.Z);
+      Element yy4 = F.add(yy, yy);
+      yy4 = F.add(yy4, yy4);
+
+      // S = 4 * X * YY
+      Element s = F.mul(P.X, yy4);
+
+      // M = 3 * XX + a * ZZ^2
+      Element m;
+      if constexpr (Field::kCoefficientA == CoefficientA::kMinusThree) {
+        m = F.mul(F.sub(P.X, zz), F.add(P.X, zz));
+        m = F.add(F.add(m, m), m);
+      } else if constexpr (Field::kCoefficientA == CoefficientA::kZero) {
+        Element xx = F.sqr(P.X);
+        m = F.add(F.add(xx, xx), xx);
+      } else {
+        if (F.aIsZero()) {
+          Element xx = F.sqr(P.X);
+          m = F.add(F.add(xx, xx), xx);
+        } else {
+          Wide m_wide = F.mulWide(P.X, F.add(F.add(P.X, P.X), P.X));
+          F.addWide(m_wide, F.mulWide(F.a(), F.sqr(zz)));
+          m = F.reduce(m_wide);
+        }
+      }
+
+      // X3 = M^2 - 2 * S
+      Element x3 = F.sub(F.sqr(m), F.add(s, s));
+
+      // Y3 = M * (S - X3) - 8 * YYYY = M * (S - X3) + (-8 * YY) * YY
+      Wide y3_wide = F.mulWide(m, F.sub(s, x3));
+      F.addWide(y3_wide, F.mulWide(F.neg(F.add(yy4, yy4)), yy));
+      Element y3 = F.reduce(y3_wide);
+
+      // Z3 = (Y + Z)^2 - YY - ZZ = 2 * Y * Z
+      Element z3 = F.sub(F.sub(F.sqr(F.add(P.Y, P.Z)), yy), zz);
+
+      return {x3, y3, z3};
+    }
+
+    /*
+     * Hàm cộng hai điểm Jacobian (add-2007-bl)
+     * @note Tự chuyển sang nhân đôi nếu P = Q
+     */
+    template <class Field>
+    JacobianPoint<Field> jacobianAdd(const Field &F,
+                                     const JacobianPoint<Field> &P,
+                                     const JacobianPoint<Field> &Q) {
+      using Element = typename Field::Element;
+      if (jacobianIsInfinity(F, P)) {
+        return Q;
+      }
+      if (jacobianIsInfinity(F, Q)) {
+        return P;
+      }
+      Element z1z1 = F.sqr(P.Z);
+      Element z2z2 = F.sqr(Q.Z);
+      Element u1 = F.mul(P.X, z2z2);
+      Element u2 = F.mul(Q.X, z1z1);
+      Element s1 = F.mul(P.Y, F.mul(Q.Z, z2z2));
+      Element s2 = F.mul(Q.Y, F.mul(P.Z, z1z1));
+
+      Element h = F.sub(u2, u1);
+      Element r = F.sub(s2, s1);
+      if (F.isZero(h)) {
+        // Cùng hoành độ: P = Q hoặc P = -Q
+        if (F.isZero(r)) {
+          return jacobianDouble(F, P);
+        }
+        return jacobianInfinity(F);
+      }
+      r = F.add(r, r);
+
+      Element i = F.sqr(F.add(h, h));
+      Element j = F.mul(h, i);
+      Element v = F.mul(u1, i);
+
+      // X3 = r^2 - J - 2 * V
+      Element x3 = F.sub(F.sub(F.sqr(r), j), F.add(v, v));
+      // Y3 = r * (V - X3) - 2 * S1 * J
+      // Hai tích được cộng dồn ở dạng chưa rút gọn rồi rút gọn một lần
+      typename Field::Wide y3_wide = F.mulWide(r, F.sub(v, x3));
+      F.addWide(y3_wide, F.mulWide(F.neg(F.add(s1, s1)), j));
+      Element y3 = F.reduce(y3_wide);
+      // Z3 = ((Z1 + Z2)^2 - Z1Z1 - Z2Z2) * H
+      Element z3 =
+          F.mul(F.sub(F.sub(F.sqr(F.add(P.Z, Q.Z)), z1z1), z2z2), h);
+
+      return {x3, y3, z3};
+    }
+
+    /*
+     * Hàm cộng hỗn hợp: P ở tọa độ Jacobian, Q ở tọa độ affine (madd-2007-bl)
+     * @note Rẻ hơn jacobianAdd vì Z2 = 1
+     */
+    template <class Field>
+    JacobianPoint<Field> jacobianAddMixed(const Field &F,
+                                          const JacobianPoint<Field> &P,
+                                          const AffinePoint<Field> &Q) {
+      using Element = typename Field::Element;
+      if (Q.infinity) {
+        return P;
+      }
+      if (jacobianIsInfinity(F, P)) {
+        return toJacobian(F, Q);
+      }
+      Element z1z1 = F.sqr(P.Z);
+      Element u2 = F.mul(Q.x, z1z1);
+      Element s2 = F.mul(Q.y, F.mul(P.Z, z1z1));
+
+      Element h = F.sub(u2, P.X);
+      Element r = F.sub(s2, P.Y);
+      if (F.isZero(h)) {
+        if (F.isZero(r)) {
+          return jacobianDouble(F, P);
+        }
+        return jacobianInfinity(F);
+      }
+      r = F.add(r, r);
+
+      Element hh = F.sqr(h);
+      Element i = F.add(hh, hh);
+      i = F.add(i, i);
+      Element j = F.mul(h, i);
+      Element v = F.mul(P.X, i);
+
+      // X3 = r^2 - J - 2 * V
+      Element x3 = F.sub(F.sub(F.sqr(r), j), F.add(v, v));
+      // Y3 = r * (V - X3) - 2 * Y1 * J
+      // Hai tích được cộng dồn ở dạng chưa rút gọn rồi rút gọn một lần
+      typename Field::Wide y3_wide = F.mulWide(r, F.sub(v, x3));
+      F.addWide(y3_wide, F.mulWide(F.neg(F.add(P.Y, P.Y)), j));
+      Element y3 = F.reduce(y3_wide);
+      // Z3 = (Z1 + H)^2 - Z1Z1 - HH = 2 * Z1 * H
+      Element z3 = F.sub(F.sub(F.sqr(F.add(P.Z, h)), z1z1), hh);
+
+      return {x3, y3, z3};
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // JACOBIAN_HPP
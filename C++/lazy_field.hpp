@@ -0,0 +1,53 @@
+#ifndef LAZY_FIELD_HPP
+#define LAZY_FIELD_HPP
+
+#include <cstdint>
+
+#include "uint.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Tổng các tích 512-bit chưa rút gọn: value + overflow * 2^512
+     * @note Dùng để cộng dồn nhiều tích a * b rồi rút gọn mod p một lần
+     * (lazy reduction), thay vì rút gọn sau từng phép nhân
+     */
+    struct WideSum {
+      U512 value;
+      uint64_t overflow = 0;
+
+      WideSum() = default;
+      explicit WideSum(const U512 &product) : value(product) {}
+
+      /*
+       * Cộng thêm một tích chưa rút gọn
+       * @param other Tổng khác
+       */
+      void add(const WideSum &other) {
+        overflow += value.addCarry(other.value) + other.overflow;
+      }
+    };
+
+    /*
+     * Hàm gấp phần tràn của WideSum về một số 512-bit cùng lớp đồng dư mod p
+     * @param sum Tổng chưa rút gọn
+     * @param k 2^512 mod p
+     * @return U512 đồng dư với sum mod p
+     * @note Mỗi vòng thay overflow * 2^512 bằng overflow * k; với overflow
+     * nhỏ chỉ cần một hoặc hai vòng
+     */
+    inline U512 foldOverflow(const WideSum &sum, const U256 &k) {
+      U512 result = sum.value;
+      uint64_t overflow = sum.overflow;
+      while (overflow != 0) {
+        U512 term(mulWide(k, UInt<64>(overflow)));
+        overflow = result.addCarry(term);
+      }
+      return result;
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // LAZY_FIELD_HPP
@@ -0,0 +1,192 @@
+#include "modinv.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+namespace shared_model {
+  namespace crypto {
+
+    namespace {
+      // Số limb tối đa dùng bộ nhớ trên stack (512 bit)
+      constexpr size_t kStackLimbs = 8;
+
+      bool isZero(const uint64_t *x, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+          if (x[i] != 0) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      bool isOne(const uint64_t *x, size_t n) {
+        return x[0] == 1 && isZero(x + 1, n - 1);
+      }
+
+      bool greaterOrEqual(const uint64_t *x, const uint64_t *y, size_t n) {
+        for (size_t i = n; i-- > 0;) {
+          if (x[i] != y[i]) {
+            return x[i] > y[i];
+          }
+        }
+        return true;
+      }
+
+      // x += y, trả về carry
+      uint64_t addInPlace(uint64_t *x, const uint64_t *y, size_t n) {
+        uint64_t carry = 0;
+        for (size_t i = 0; i < n; ++i) {
+          uint128_t cur = static_cast<uint128_t>(x[i]) + y[i] + carry;
+          x[i] = static_cast<uint64_t>(cur);
+          carry = static_cast<uint64_t>(cur >> 64);
+        }
+        return carry;
+      }
+
+      // x -= y, trả về borrow
+      uint64_t subInPlace(uint64_t *x, const uint64_t *y, size_t n) {
+        uint64_t borrow = 0;
+        for (size_t i = 0; i < n; ++i) {
+          uint128_t cur = static_cast<uint128_t>(x[i]) - y[i] - borrow;
+          x[i] = static_cast<uint64_t>(cur);
+          borrow = static_cast<uint64_t>(cur >> 64) & 1;
+        }
+        return borrow;
+      }
+
+      // x = (top : x) >> t, 0 < t < 64
+      void shiftRight(uint64_t *x, size_t n, uint64_t top, unsigned t) {
+        for (size_t i = 0; i + 1 < n; ++i) {
+          x[i] = (x[i] >> t) | (x[i + 1] << (64 - t));
+        }
+        x[n - 1] = (x[n - 1] >> t) | (top << (64 - t));
+      }
+
+      // x = x / 2^t mod m (m lẻ, x < m, 0 < t < 64), m_inv = -m^-1 mod 2^64:
+      // cộng q * m (q < 2^t) để t bit thấp bằng 0 rồi dịch phải một lần
+      void divPow2Mod(uint64_t *x,
+                      const uint64_t *m,
+                      size_t n,
+                      uint64_t m_inv,
+                      unsigned t) {
+        const uint64_t q = (x[0] * m_inv) & ((uint64_t(1) << t) - 1);
+        uint64_t carry = 0;
+        for (size_t i = 0; i < n; ++i) {
+          uint128_t cur = static_cast<uint128_t>(q) * m[i] + x[i] + carry;
+          x[i] = static_cast<uint64_t>(cur);
+          carry = static_cast<uint64_t>(cur >> 64);
+        }
+        shiftRight(x, n, carry, t);
+      }
+
+      // Số bit 0 ở cuối của x (x khác 0), tối đa 63
+      unsigned trailingZeros(const uint64_t *x) {
+        return x[0] == 0 ? 63 : static_cast<unsigned>(__builtin_ctzll(x[0]));
+      }
+
+      // x = x - y mod m (x, y < m)
+      void subMod(uint64_t *x, const uint64_t *y, const uint64_t *m, size_t n) {
+        if (subInPlace(x, y, n)) {
+          // x - y + m nằm trong [0, m); carry khi cộng bù lại được bỏ qua
+          addInPlace(x, m, n);
+        }
+      }
+    }  // namespace
+
+    bool binaryInverseOdd(const uint64_t *a,
+                          const uint64_t *m,
+                          size_t n,
+                          uint64_t *out) {
+      // -m^-1 mod 2^64 bằng phương pháp Newton (mỗi bước gấp đôi số bit đúng)
+      uint64_t m_inv = m[0];
+      for (int i = 0; i < 5; ++i) {
+        m_inv *= 2 - m[0] * m_inv;
+      }
+      m_inv = 0 - m_inv;
+
+      // Bất biến: b * a = u, d * a = v (mod m); khi u = 0 thì v = gcd(a, m)
+      uint64_t stack_buf[4 * kStackLimbs] = {};
+      std::vector<uint64_t> heap_buf;
+      uint64_t *u = stack_buf;
+      if (n > kStackLimbs) {
+        heap_buf.assign(4 * n, 0);
+        u = heap_buf.data();
+      }
+      uint64_t *v = u + n;
+      uint64_t *b = v + n;
+      uint64_t *d = b + n;
+      for (size_t i = 0; i < n; ++i) {
+        u[i] = a[i];
+        v[i] = m[i];
+      }
+      b[0] = 1;
+
+      while (!isZero(u, n)) {
+        while (!(u[0] & 1)) {
+          unsigned t = trailingZeros(u);
+          shiftRight(u, n, 0, t);
+          divPow2Mod(b, m, n, m_inv, t);
+        }
+        while (!(v[0] & 1)) {
+          unsigned t = trailingZeros(v);
+          shiftRight(v, n, 0, t);
+          divPow2Mod(d, m, n, m_inv, t);
+        }
+        if (greaterOrEqual(u, v, n)) {
+          subInPlace(u, v, n);
+          subMod(b, d, m, n);
+        } else {
+          subInPlace(v, u, n);
+          subMod(d, b, m, n);
+        }
+      }
+      if (!isOne(v, n)) {
+        return false;
+      }
+      for (size_t i = 0; i < n; ++i) {
+        out[i] = d[i];
+      }
+      return true;
+    }
+
+    bool tryInverseMod(const BigInt &k, const BigInt &m, BigInt &inverse) {
+      if (m <= BigInt(1)) {
+        throw std::invalid_argument("Modulus must be greater than 1");
+      }
+      BigInt a = k % m;
+      if (a == BigInt(0)) {
+        return false;
+      }
+
+      if (!m.test_bit(0)) {
+        // m chẵn: a phải lẻ. Với y = m^-1 mod a, ta có m * y = 1 + a * t
+        // và a^-1 mod m = (1 + m * (a - y)) / a
+        if (!a.test_bit(0)) {
+          return false;
+        }
+        if (a == BigInt(1)) {
+          inverse = a;
+          return true;
+        }
+        BigInt y;
+        if (!tryInverseMod(m % a, a, y)) {
+          return false;
+        }
+        inverse = (BigInt(1) + m * (a - y)) / a;
+        return true;
+      }
+
+      const std::vector<uint64_t> &mod_limbs = m.limbs();
+      const size_t n = mod_limbs.size();
+      std::vector<uint64_t> a_limbs = a.limbs();
+      a_limbs.resize(n, 0);
+      std::vector<uint64_t> out(n, 0);
+      if (!binaryInverseOdd(a_limbs.data(), mod_limbs.data(), n, out.data())) {
+        return false;
+      }
+      inverse = BigInt::from_limbs(out.data(), n);
+      return true;
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
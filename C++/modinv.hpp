@@ -0,0 +1,60 @@
+#ifndef MODINV_HPP
+#define MODINV_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "bigInt.hpp"
+#include "uint.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Hàm nghịch đảo modulo lõi: thuật toán Euclid mở rộng nhị phân trên các
+     * limb (chỉ dùng dịch bit, cộng và trừ, không có phép chia)
+     * @param a Số cần nghịch đảo, n limb, 0 <= a < m
+     * @param m Modulo lẻ, n limb
+     * @param n Số limb
+     * @param out Nhận a^-1 mod m (n limb) nếu tồn tại
+     * @return false nếu gcd(a, m) != 1 (phát hiện ngay trong quá trình tính)
+     * @note Tối đa khoảng 2 * bits vòng lặp, mỗi vòng O(n)
+     * @note Thời gian chạy phụ thuộc vào giá trị của a (không hằng định)
+     */
+    bool binaryInverseOdd(const uint64_t *a,
+                          const uint64_t *m,
+                          size_t n,
+                          uint64_t *out);
+
+    /*
+     * Hàm nghịch đảo modulo cho số nguyên bất kỳ
+     * @param k Số cần nghịch đảo
+     * @param m Modulo, m > 1 (chẵn hoặc lẻ)
+     * @param inverse Nhận k^-1 mod m nếu tồn tại
+     * @return false nếu k không có nghịch đảo modulo m
+     * @note Với m chẵn, đưa về nghịch đảo m mod k theo modulo k (k lẻ)
+     * @throws std::invalid_argument nếu m <= 1
+     */
+    bool tryInverseMod(const BigInt &k, const BigInt &m, BigInt &inverse);
+
+    /*
+     * Hàm nghịch đảo modulo cho số có độ rộng cố định
+     * @param k Số cần nghịch đảo, k < m
+     * @param m Modulo lẻ
+     * @param inverse Nhận k^-1 mod m nếu tồn tại
+     * @return false nếu k không có nghịch đảo modulo m
+     */
+    template <size_t Bits>
+    bool tryInverseMod(const UInt<Bits> &k,
+                       const UInt<Bits> &m,
+                       UInt<Bits> &inverse) {
+      return binaryInverseOdd(k.limbs().data(),
+                              m.limbs().data(),
+                              UInt<Bits>::kLimbs,
+                              inverse.limbs().data());
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // MODINV_HPP
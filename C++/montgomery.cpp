@@ -0,0 +1,157 @@
+#include "montgomery.hpp"
+
+#include <stdexcept>
+
+#include "window_pow.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    MontgomeryContext::MontgomeryContext(const BigInt &modulus)
+        : m_(modulus), mods_(modulus.limbs()), n_(modulus.limbs().size()) {
+      // m phải lẻ để tồn tại m^-1 mod 2^64
+      if (!m_.test_bit(0) || m_ < BigInt(3)) {
+        throw std::invalid_argument("Montgomery modulus must be odd and >= 3");
+      }
+
+      // Tính m^-1 mod 2^64 bằng phương pháp Newton, mỗi vòng gấp đôi số bit
+      // đúng (m0 * m0 = 1 mod 8 nên ban đầu đã đúng 3 bit)
+      uint64_t inv = mods_[0];
+      for (int i = 0; i < 5; ++i) {
+        inv *= 2 - mods_[0] * inv;
+      }
+      m_inv_ = ~inv + 1;  // -m^-1 mod 2^64
+
+      // R mod m và R^2 mod m, chỉ cần tính một lần cho mỗi modulo
+      std::vector<uint64_t> r(n_ + 1, 0);
+      r[n_] = 1;
+      one_ = BigInt::from_limbs(r.data(), r.size()) % m_;
+      std::vector<uint64_t> r2(2 * n_ + 1, 0);
+      r2[2 * n_] = 1;
+      r2_ = BigInt::from_limbs(r2.data(), r2.size()) % m_;
+    }
+
+    void MontgomeryContext::load(const BigInt &a,
+                                 std::vector<uint64_t> &out) const {
+      const std::vector<uint64_t> &limbs = a.limbs();
+      out.assign(n_, 0);
+      for (size_t i = 0; i < limbs.size() && i < n_; ++i) {
+        out[i] = limbs[i];
+      }
+    }
+
+    void MontgomeryContext::montMul(const uint64_t *a,
+                                    const uint64_t *b,
+                                    uint64_t *out,
+                                    uint64_t *scratch) const {
+      uint64_t *t = scratch;
+      for (size_t i = 0; i < n_ + 2; ++i) {
+        t[i] = 0;
+      }
+
+      for (size_t i = 0; i < n_; ++i) {
+        // 1. t += a * b[i]
+        uint64_t carry = 0;
+        for (size_t j = 0; j < n_; ++j) {
+          uint128_t cur =
+              static_cast<uint128_t>(a[j]) * b[i] + t[j] + carry;
+          t[j] = static_cast<uint64_t>(cur);
+          carry = static_cast<uint64_t>(cur >> 64);
+        }
+        uint128_t top = static_cast<uint128_t>(t[n_]) + carry;
+        t[n_] = static_cast<uint64_t>(top);
+        t[n_ + 1] = static_cast<uint64_t>(top >> 64);
+
+        // 2. t = (t + u * m) / 2^64 với u chọn sao cho limb thấp bằng 0
+        uint64_t u = t[0] * m_inv_;
+        uint128_t cur = static_cast<uint128_t>(u) * mods_[0] + t[0];
+        carry = static_cast<uint64_t>(cur >> 64);
+        for (size_t j = 1; j < n_; ++j) {
+          cur = static_cast<uint128_t>(u) * mods_[j] + t[j] + carry;
+          t[j - 1] = static_cast<uint64_t>(cur);
+          carry = static_cast<uint64_t>(cur >> 64);
+        }
+        top = static_cast<uint128_t>(t[n_]) + carry;
+        t[n_ - 1] = static_cast<uint64_t>(top);
+        t[n_] = t[n_ + 1] + static_cast<uint64_t>(top >> 64);
+      }
+
+      // 3. Kết quả < 2m, trừ m một lần nếu cần
+      bool ge = t[n_] != 0;
+      if (!ge) {
+        ge = true;
+        for (size_t i = n_; i-- > 0;) {
+          if (t[i] != mods_[i]) {
+            ge = t[i] > mods_[i];
+            break;
+          }
+        }
+      }
+      if (ge) {
+        uint64_t borrow = 0;
+        for (size_t i = 0; i < n_; ++i) {
+          uint128_t diff =
+              static_cast<uint128_t>(t[i]) - mods_[i] - borrow;
+          out[i] = static_cast<uint64_t>(diff);
+          borrow = static_cast<uint64_t>(diff >> 64) != 0 ? 1 : 0;
+        }
+      } else {
+        for (size_t i = 0; i < n_; ++i) {
+          out[i] = t[i];
+        }
+      }
+    }
+
+    BigInt MontgomeryContext::toMontgomery(const BigInt &a) const {
+      // a * R = REDC(a * R^2)
+      return mul(a < m_ ? a : a % m_, r2_);
+    }
+
+    BigInt MontgomeryContext::fromMontgomery(const BigInt &a) const {
+      // a * R^-1 = REDC(a * 1)
+      return mul(a, BigInt(1));
+    }
+
+    BigInt MontgomeryContext::mul(const BigInt &a, const BigInt &b) const {
+      std::vector<uint64_t> x;
+      std::vector<uint64_t> y;
+      std::vector<uint64_t> scratch(n_ + 2);
+      load(a, x);
+      load(b, y);
+      montMul(x.data(), y.data(), x.data(), scratch.data());
+      return BigInt::from_limbs(x.data(), n_);
+    }
+
+    BigInt MontgomeryContext::sqr(const BigInt &a) const {
+      return mul(a, a);
+    }
+
+    BigInt MontgomeryContext::pow(const BigInt &base, const BigInt &exp) const {
+      // Vòng lặp làm việc trên các buffer cố định, không chia và chỉ cấp
+      // phát khi dựng bảng lũy thừa lẻ
+      std::vector<uint64_t> acc;
+      std::vector<uint64_t> b;
+      std::vector<uint64_t> scratch(n_ + 2);
+      load(one_, acc);
+      load(toMontgomery(base), b);
+
+      slidingWindowPow(
+          acc,
+          b,
+          exp,
+          [&](std::vector<uint64_t> &x) {
+            montMul(x.data(), x.data(), x.data(), scratch.data());
+          },
+          [&](std::vector<uint64_t> &x, const std::vector<uint64_t> &y) {
+            montMul(x.data(), y.data(), x.data(), scratch.data());
+          });
+
+      // Chuyển về dạng thường
+      std::vector<uint64_t> unit(n_, 0);
+      unit[0] = 1;
+      montMul(acc.data(), unit.data(), acc.data(), scratch.data());
+      return BigInt::from_limbs(acc.data(), n_);
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
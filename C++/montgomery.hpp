@@ -0,0 +1,104 @@
+#ifndef MONTGOMERY_HPP
+#define MONTGOMERY_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "bigInt.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Ngữ cảnh nhân Montgomery cho một modulo lẻ cố định m.
+     * Được tạo một lần cho mỗi modulo rồi dùng lại cho nhiều phép nhân và
+     * lũy thừa, để vòng lặp bên trong không cần phép chia nào.
+     * @note Với R = 2^(64 * n) (n là số limb của m), dạng Montgomery của a
+     * là a * R mod m
+     * @note mul() và sqr() nhận và trả về giá trị ở dạng Montgomery
+     */
+    class MontgomeryContext {
+     public:
+      /*
+       * Constructor cho ngữ cảnh Montgomery
+       * @param modulus Modulo m
+       * @throws std::invalid_argument nếu m chẵn hoặc m < 3
+       */
+      explicit MontgomeryContext(const BigInt &modulus);
+
+      const BigInt &modulus() const {
+        return m_;
+      }
+
+      /*
+       * Hàm chuyển a sang dạng Montgomery
+       * @param a Số nguyên bất kỳ
+       * @return a * R mod m
+       */
+      BigInt toMontgomery(const BigInt &a) const;
+
+      /*
+       * Hàm chuyển a từ dạng Montgomery về dạng thường
+       * @param a Giá trị ở dạng Montgomery (a < m)
+       * @return a * R^-1 mod m
+       */
+      BigInt fromMontgomery(const BigInt &a) const;
+
+      /*
+       * Hàm nhân hai giá trị ở dạng Montgomery
+       * @param a Giá trị ở dạng Montgomery (a < m)
+       * @param b Giá trị ở dạng Montgomery (b < m)
+       * @return a * b * R^-1 mod m (vẫn ở dạng Montgomery)
+       */
+      BigInt mul(const BigInt &a, const BigInt &b) const;
+
+      /*
+       * Hàm bình phương một giá trị ở dạng Montgomery
+       * @param a Giá trị ở dạng Montgomery (a < m)
+       * @return a * a * R^-1 mod m (vẫn ở dạng Montgomery)
+       */
+      BigInt sqr(const BigInt &a) const;
+
+      /*
+       * Hàm tính lũy thừa base^exp mod m
+       * @param base Cơ sở (dạng thường)
+       * @param exp Số mũ
+       * @return base^exp mod m (dạng thường)
+       * @note Dùng sliding-window với bảng lũy thừa lẻ (window_pow.hpp)
+       */
+      BigInt pow(const BigInt &base, const BigInt &exp) const;
+
+      /*
+       * Giá trị 1 ở dạng Montgomery (R mod m)
+       */
+      const BigInt &one() const {
+        return one_;
+      }
+
+     private:
+      // Chép các limb của a vào out, thêm các limb 0 cho đủ n_ limb
+      void load(const BigInt &a, std::vector<uint64_t> &out) const;
+
+      /*
+       * Nhân Montgomery kiểu CIOS trên các mảng n_ limb
+       * @param a, b Thừa số (n_ limb, nhỏ hơn m)
+       * @param out Kết quả a * b * R^-1 mod m (n_ limb, có thể trùng a/b)
+       * @param scratch Vùng nhớ tạm n_ + 2 limb
+       */
+      void montMul(const uint64_t *a,
+                   const uint64_t *b,
+                   uint64_t *out,
+                   uint64_t *scratch) const;
+
+      BigInt m_;                    // Modulo
+      std::vector<uint64_t> mods_;  // Các limb của m
+      size_t n_;                    // Số limb của m
+      uint64_t m_inv_;              // -m^-1 mod 2^64
+      BigInt one_;                  // R mod m
+      BigInt r2_;                   // R^2 mod m
+    };
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // MONTGOMERY_HPP
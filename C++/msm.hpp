@@ -0,0 +1,127 @@
+#ifndef MSM_HPP
+#define MSM_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "bigInt.hpp"
+#include "jacobian.hpp"
+#include "wnaf.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    // Từ số điểm này trở lên, multiScalarMultiply() dùng Pippenger thay vì
+    // Strauss
+    constexpr size_t kPippengerThreshold = 128;
+
+    // Độ rộng cửa sổ wNAF của Strauss trong multiScalarMultiply()
+    constexpr size_t kStraussWindow = 5;
+
+    /*
+     * Hàm chọn độ rộng cửa sổ c của Pippenger cho n điểm
+     * @note Chi phí khoảng bits / c * (n + 2^(c+1)) phép cộng, nhỏ nhất khi
+     * 2^c xấp xỉ n / 4
+     */
+    inline size_t pippengerWindow(size_t n) {
+      size_t log_n = 0;
+      while ((size_t(1) << (log_n + 1)) <= n) {
+        ++log_n;
+      }
+      return std::min<size_t>(std::max<size_t>(log_n, 4) - 2, 16);
+    }
+
+    /*
+     * Hàm tính tổng scalars[i] * points[i] theo Pippenger (bucket method)
+     * @param F FieldOps của đường cong
+     * @param points Các điểm (affine)
+     * @param scalars Các số nhân không âm, cùng kích thước với points
+     * @param window Độ rộng cửa sổ c (số bit mỗi lượt), c >= 1
+     * @return Tổng ở tọa độ Jacobian
+     * @note Mỗi lượt c bit, điểm được cộng hỗn hợp vào bucket theo chữ số
+     * của số nhân, sau đó các bucket được gộp bằng tổng chạy; tổng chi phí
+     * khoảng bits / c * (n + 2^(c+1)) phép cộng
+     */
+    template <class Field>
+    JacobianPoint<Field> pippengerMultiply(
+        const Field &F,
+        const std::vector<AffinePoint<Field>> &points,
+        const std::vector<BigInt> &scalars,
+        size_t window) {
+      size_t bits = 0;
+      for (size_t i = 0; i < points.size(); ++i) {
+        if (!points[i].infinity) {
+          bits = std::max(bits, scalars[i].bit_length());
+        }
+      }
+      const size_t rounds = (bits + window - 1) / window;
+      const size_t bucket_count = (size_t(1) << window) - 1;
+
+      JacobianPoint<Field> R = jacobianInfinity(F);
+      std::vector<JacobianPoint<Field>> buckets;
+      for (size_t round = rounds; round-- > 0;) {
+        for (size_t b = 0; b < window; ++b) {
+          R = jacobianDouble(F, R);
+        }
+
+        // Bucket j chứa tổng các điểm có chữ số j + 1 ở lượt này
+        buckets.assign(bucket_count, jacobianInfinity(F));
+        for (size_t i = 0; i < points.size(); ++i) {
+          if (points[i].infinity) {
+            continue;
+          }
+          size_t digit = 0;
+          for (size_t b = 0; b < window; ++b) {
+            if (scalars[i].test_bit(round * window + b)) {
+              digit |= size_t(1) << b;
+            }
+          }
+          if (digit != 0) {
+            buckets[digit - 1] =
+                jacobianAddMixed(F, buckets[digit - 1], points[i]);
+          }
+        }
+
+        // sum(j * bucket_j) = tổng các tổng chạy từ bucket cao xuống thấp
+        JacobianPoint<Field> running = jacobianInfinity(F);
+        JacobianPoint<Field> sum = jacobianInfinity(F);
+        for (size_t j = bucket_count; j-- > 0;) {
+          running = jacobianAdd(F, running, buckets[j]);
+          sum = jacobianAdd(F, sum, running);
+        }
+        R = jacobianAdd(F, R, sum);
+      }
+      return R;
+    }
+
+    /*
+     * Hàm nhân đa vô hướng: tổng scalars[i] * points[i]
+     * @param F FieldOps của đường cong
+     * @param points Các điểm (affine)
+     * @param scalars Các số nhân không âm, cùng kích thước với points
+     * @return Tổng ở tọa độ Jacobian
+     * @note Dùng Strauss khi có ít điểm và Pippenger khi có từ
+     * kPippengerThreshold điểm trở lên
+     * @throws std::invalid_argument nếu points và scalars khác kích thước
+     */
+    template <class Field>
+    JacobianPoint<Field> multiScalarMultiply(
+        const Field &F,
+        const std::vector<AffinePoint<Field>> &points,
+        const std::vector<BigInt> &scalars) {
+      if (points.size() != scalars.size()) {
+        throw std::invalid_argument("points and scalars differ in size");
+      }
+      if (points.size() < kPippengerThreshold) {
+        return straussMultiply(F, points, scalars, kStraussWindow);
+      }
+      return pippengerMultiply(
+          F, points, scalars, pippengerWindow(points.size()));
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // MSM_HPP
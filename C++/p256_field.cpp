@@ -0,0 +1,186 @@
+#include "p256_field.hpp"
+
+#include <stdexcept>
+
+#include "modinv.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    namespace {
+      const U256 kPrime = U256::from_hex(
+          "0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF");
+
+      // 2^512 mod p, dùng để gấp phần tràn của WideSum
+      const U256 kWideFold = U256((BigInt(1) << 512) % kPrime.toBigInt());
+    }  // namespace
+
+    P256Field::P256Field(const U256 &value) : v_(value) {
+      // value < 2^256 < 2p nên chỉ cần trừ p tối đa một lần
+      if (v_ >= kPrime) {
+        v_ -= kPrime;
+      }
+    }
+
+    P256Field::P256Field(const BigInt &value) {
+      if (value.bit_length() <= 256) {
+        *this = P256Field(U256(value));
+      } else {
+        v_ = U256(value % kPrime.toBigInt());
+      }
+    }
+
+    const U256 &P256Field::modulus() {
+      return kPrime;
+    }
+
+    bool P256Field::isModulus(const BigInt &p) {
+      return p.bit_length() == 256 && U256(p) == kPrime;
+    }
+
+    U256 P256Field::reduce(const U512 &wide) {
+      const auto &w = wide.limbs();
+      // c[i] là từ 32-bit thứ i của tích (c[0] thấp nhất)
+      int64_t c[16];
+      for (size_t i = 0; i < 8; ++i) {
+        c[2 * i] = static_cast<int64_t>(w[i] & 0xFFFFFFFFULL);
+        c[2 * i + 1] = static_cast<int64_t>(w[i] >> 32);
+      }
+
+      // Từ thứ j của s1 + 2 s2 + 2 s3 + s4 + s5 - d1 - d2 - d3 - d4; mỗi tổng
+      // nằm trong (-2^35, 2^35) nên không tràn int64_t
+      const int64_t t[8] = {
+          c[0] + c[8] + c[9] - c[11] - c[12] - c[13] - c[14],
+          c[1] + c[9] + c[10] - c[12] - c[13] - c[14] - c[15],
+          c[2] + c[10] + c[11] - c[13] - c[14] - c[15],
+          c[3] + 2 * c[11] + 2 * c[12] + c[13] - c[15] - c[8] - c[9],
+          c[4] + 2 * c[12] + 2 * c[13] + c[14] - c[9] - c[10],
+          c[5] + 2 * c[13] + 2 * c[14] + c[15] - c[10] - c[11],
+          c[6] + 2 * c[14] + 2 * c[15] + c[14] + c[13] - c[8] - c[9],
+          c[7] + 2 * c[15] + c[15] + c[8] - c[10] - c[11] - c[12] - c[13],
+      };
+
+      // Lan truyền carry có dấu qua các từ 32-bit; phần tràn cuối cùng
+      // (hệ số của 2^256) nằm trong khoảng nhỏ quanh 0
+      U256 result;
+      auto &r = result.limbs();
+      int64_t carry = 0;
+      for (size_t i = 0; i < 4; ++i) {
+        int64_t lo = t[2 * i] + carry;
+        carry = lo >> 32;  // Dịch số học: floor(lo / 2^32)
+        int64_t hi = t[2 * i + 1] + carry;
+        carry = hi >> 32;
+        r[i] = (static_cast<uint64_t>(lo) & 0xFFFFFFFFULL)
+            | (static_cast<uint64_t>(hi) << 32);
+      }
+
+      // Đưa carry * 2^256 + result về [0, p) bằng vài lần cộng/trừ p
+      while (carry < 0) {
+        carry += static_cast<int64_t>(result.addCarry(kPrime));
+      }
+      while (carry > 0) {
+        carry -= static_cast<int64_t>(result.subBorrow(kPrime));
+      }
+      if (result >= kPrime) {
+        result -= kPrime;
+      }
+      return result;
+    }
+
+    P256Field P256Field::reduceWide(const WideSum &sum) {
+      P256Field result;
+      result.v_ = reduce(foldOverflow(sum, kWideFold));
+      return result;
+    }
+
+    P256Field P256Field::operator+(const P256Field &rhs) const {
+      P256Field result = *this;
+      result += rhs;
+      return result;
+    }
+
+    P256Field P256Field::operator-(const P256Field &rhs) const {
+      P256Field result = *this;
+      result -= rhs;
+      return result;
+    }
+
+    P256Field P256Field::operator*(const P256Field &rhs) const {
+      P256Field result;
+      result.v_ = reduce(mulWide(v_, rhs.v_));
+      return result;
+    }
+
+    P256Field P256Field::operator-() const {
+      P256Field result;
+      if (!isZero()) {
+        result.v_ = kPrime - v_;
+      }
+      return result;
+    }
+
+    P256Field &P256Field::operator+=(const P256Field &rhs) {
+      // a + b < 2p; nếu tràn 2^256 thì phép trừ p (mod 2^256) cho đúng kết quả
+      if (v_.addCarry(rhs.v_) != 0 || v_ >= kPrime) {
+        v_.subBorrow(kPrime);
+      }
+      return *this;
+    }
+
+    P256Field &P256Field::operator-=(const P256Field &rhs) {
+      // Nếu a < b thì a - b + p = (a - b + 2^256) + p (mod 2^256)
+      if (v_.subBorrow(rhs.v_) != 0) {
+        v_.addCarry(kPrime);
+      }
+      return *this;
+    }
+
+    P256Field &P256Field::operator*=(const P256Field &rhs) {
+      v_ = reduce(mulWide(v_, rhs.v_));
+      return *this;
+    }
+
+    P256Field P256Field::sqr() const {
+      P256Field result;
+      result.v_ = reduce(sqrWide(v_));
+      return result;
+    }
+
+    P256Field P256Field::sqrTimes(size_t count) const {
+      P256Field result = *this;
+      for (size_t i = 0; i < count; ++i) {
+        result = result.sqr();
+      }
+      return result;
+    }
+
+    P256Field P256Field::inverse() const {
+      if (isZero()) {
+        throw std::invalid_argument("k is 0");
+      }
+      P256Field result;
+      tryInverseMod(v_, kPrime, result.v_);
+      return result;
+    }
+
+    bool P256Field::sqrt(P256Field &root) const {
+      // Chuỗi cộng cố định cho (p + 1) / 4 = (2^32 - 1) * 2^222 + 2^190 + 2^94:
+      // xN là this^(2^N - 1); tổng cộng 253 phép bình phương và 7 phép nhân
+      const P256Field &a = *this;
+      P256Field x2 = a.sqr() * a;
+      P256Field x4 = x2.sqrTimes(2) * x2;
+      P256Field x8 = x4.sqrTimes(4) * x4;
+      P256Field x16 = x8.sqrTimes(8) * x8;
+      P256Field x32 = x16.sqrTimes(16) * x16;
+      P256Field candidate = x32.sqrTimes(32) * a;
+      candidate = candidate.sqrTimes(96) * a;
+      candidate = candidate.sqrTimes(94);
+      if (candidate.sqr() != *this) {
+        return false;
+      }
+      root = candidate;
+      return true;
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
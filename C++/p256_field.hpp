@@ -0,0 +1,159 @@
+#ifndef P256_FIELD_HPP
+#define P256_FIELD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+#include "bigInt.hpp"
+#include "lazy_field.hpp"
+#include "uint.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Phần tử của trường hữu hạn Z_p với p = 2^256 - 2^224 + 2^192 + 2^96 - 1
+     * (NIST P-256 / secp256r1).
+     * p là số Mersenne tổng quát nên tích 512-bit được rút gọn bằng phương
+     * pháp Solinas (FIPS 186-4, D.2.3): cộng trừ 9 số 256-bit ghép từ các từ
+     * 32-bit của tích, không cần phép chia.
+     * @note Giá trị luôn được lưu ở dạng đã rút gọn, trong [0, p)
+     */
+    class P256Field {
+     public:
+      /*
+       * Constructor mặc định, giá trị 0
+       */
+      P256Field() = default;
+
+      /*
+       * Constructor từ uint64_t
+       * @param value Giá trị (luôn nhỏ hơn p)
+       */
+      explicit P256Field(uint64_t value) : v_(value) {}
+
+      /*
+       * Constructor từ U256
+       * @param value Giá trị bất kỳ, được rút gọn mod p
+       */
+      explicit P256Field(const U256 &value);
+
+      /*
+       * Constructor từ BigInt
+       * @param value Giá trị bất kỳ, được rút gọn mod p
+       */
+      explicit P256Field(const BigInt &value);
+
+      /*
+       * Hàm trả về số nguyên tố p của trường
+       * @return p = 2^256 - 2^224 + 2^192 + 2^96 - 1
+       */
+      static const U256 &modulus();
+
+      /*
+       * Kiểm tra xem p có phải là số nguyên tố của P-256 hay không
+       * @param p Số nguyên cần kiểm tra
+       * @return true nếu p = 2^256 - 2^224 + 2^192 + 2^96 - 1
+       */
+      static bool isModulus(const BigInt &p);
+
+      const U256 &value() const {
+        return v_;
+      }
+
+      BigInt toBigInt() const {
+        return v_.toBigInt();
+      }
+
+      bool isZero() const {
+        return v_.isZero();
+      }
+
+      bool isOdd() const {
+        return (v_.limbs()[0] & 1) != 0;
+      }
+
+      // Arithmetic operators (mod p)
+      P256Field operator+(const P256Field &rhs) const;
+      P256Field operator-(const P256Field &rhs) const;
+      P256Field operator*(const P256Field &rhs) const;
+      P256Field operator-() const;
+
+      P256Field &operator+=(const P256Field &rhs);
+      P256Field &operator-=(const P256Field &rhs);
+      P256Field &operator*=(const P256Field &rhs);
+
+      /*
+       * Hàm bình phương
+       * @return this^2 mod p
+       */
+      P256Field sqr() const;
+
+      /*
+       * Hàm tính nghịch đảo
+       * @return this^-1 mod p
+       * @throws std::invalid_argument nếu phần tử bằng 0
+       * @note Dùng Euclid nhị phân (tryInverseMod)
+       */
+      P256Field inverse() const;
+
+      /*
+       * Hàm tính căn bậc hai
+       * @param root Căn bậc hai (nếu tồn tại)
+       * @return true nếu phần tử là số chính phương mod p
+       * @note Vì p = 3 mod 4 nên root = this^((p + 1) / 4), tính bằng một
+       * chuỗi cộng cố định
+       */
+      bool sqrt(P256Field &root) const;
+
+      /*
+       * Hàm nhân không rút gọn, để cộng dồn nhiều tích trước khi rút gọn
+       * @return a * b dạng 512-bit (xem lazy_field.hpp)
+       */
+      static WideSum mulUnreduced(const P256Field &a, const P256Field &b) {
+        return WideSum(mulWide(a.v_, b.v_));
+      }
+
+      /*
+       * Hàm rút gọn một tổng các tích chưa rút gọn
+       * @param sum Tổng chưa rút gọn
+       * @return sum mod p
+       */
+      static P256Field reduceWide(const WideSum &sum);
+
+      // Comparison operators
+      bool operator==(const P256Field &rhs) const {
+        return v_ == rhs.v_;
+      }
+      bool operator!=(const P256Field &rhs) const {
+        return v_ != rhs.v_;
+      }
+
+      // Debug
+      friend std::ostream &operator<<(std::ostream &os, const P256Field &f) {
+        return os << f.v_;
+      }
+
+     private:
+      /*
+       * Hàm rút gọn Solinas một tích 512-bit về [0, p)
+       * @param wide Tích 512-bit
+       * @return wide mod p
+       */
+      static U256 reduce(const U512 &wide);
+
+      /*
+       * Hàm bình phương lặp, dùng cho chuỗi cộng của sqrt()
+       * @param count Số lần bình phương
+       * @return this^(2^count) mod p
+       */
+      P256Field sqrTimes(size_t count) const;
+
+      U256 v_;
+    };
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // P256_FIELD_HPP
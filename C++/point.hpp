@@ -4,6 +4,7 @@
 
 #include <cstdint>
 #include <iostream>
+#include <utility>
 #include "bigInt.hpp"
 
 namespace shared_model {
@@ -26,17 +27,17 @@ class Point {
     * @param y Tung độ
     * @note is_infinity_ được đặt thành false
     */
-  Point(BigInt x, BigInt y) : x_(x), y_(y), is_infinity_(false) {}
-  Point(const Point &other) = default;
+  Point(BigInt x, BigInt y)
+      : x_(std::move(x)), y_(std::move(y)), is_infinity_(false) {}
 
-  BigInt x() const {
+  const BigInt &x() const {
     if (is_infinity_) {
       throw std::logic_error("Cannot access x() of point at infinity");
     }
     return x_;
   }
 
-  BigInt y() const {
+  const BigInt &y() const {
     if (is_infinity_) {
       throw std::logic_error("Cannot access y() of point at infinity");
     }
@@ -0,0 +1,250 @@
+#include "scalar.hpp"
+
+#include <stdexcept>
+
+#include "modinv.hpp"
+#include "window_pow.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    ScalarField::ScalarField(const BigInt &order) : n_big_(order) {
+      if (order < BigInt(2) || order.bit_length() > 256) {
+        throw std::invalid_argument("Scalar order must be in [2, 2^256)");
+      }
+      n_ = U256(order);
+      k_ = order.limbs().size();
+
+      // mu = floor(b^(2k) / n) với b = 2^64, tối đa k + 1 limb trừ khi n
+      // là lũy thừa của b
+      std::vector<uint64_t> b2k(2 * k_ + 1, 0);
+      b2k[2 * k_] = 1;
+      BigInt mu = BigInt::from_limbs(b2k.data(), b2k.size()) / order;
+      if (mu.limbs().size() > k_ + 1) {
+        throw std::invalid_argument("Scalar order must not be a power of 2^64");
+      }
+      mu_ = UInt<320>(mu);
+    }
+
+    U256 ScalarField::reduce(const U512 &x) const {
+      const auto &xl = x.limbs();
+      const auto &nl = n_.limbs();
+      const auto &ml = mu_.limbs();
+      const size_t k = k_;
+
+      // Barrett yêu cầu x < b^(2k); với n nhỏ mà x lớn thì dùng phép chia
+      for (size_t i = 2 * k; i < U512::kLimbs; ++i) {
+        if (xl[i] != 0) {
+          return U256(x.toBigInt() % n_big_);
+        }
+      }
+
+      // 1. q1 = floor(x / b^(k-1)), k + 1 limb
+      uint64_t q1[5] = {0, 0, 0, 0, 0};
+      for (size_t i = 0; i <= k; ++i) {
+        q1[i] = xl[k - 1 + i];
+      }
+
+      // 2. q2 = q1 * mu, q3 = floor(q2 / b^(k+1))
+      uint64_t q2[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+      for (size_t i = 0; i <= k; ++i) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j <= k; ++j) {
+          uint128_t cur = static_cast<uint128_t>(q1[i]) * ml[j] + q2[i + j]
+              + carry;
+          q2[i + j] = static_cast<uint64_t>(cur);
+          carry = static_cast<uint64_t>(cur >> 64);
+        }
+        q2[i + k + 1] = carry;
+      }
+      const uint64_t *q3 = q2 + k + 1;
+
+      // 3. r2 = (q3 * n) mod b^(k+1), chỉ cần k + 1 limb thấp
+      uint64_t r2[5] = {0, 0, 0, 0, 0};
+      for (size_t i = 0; i <= k; ++i) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < k && i + j <= k; ++j) {
+          uint128_t cur = static_cast<uint128_t>(q3[i]) * nl[j] + r2[i + j]
+              + carry;
+          r2[i + j] = static_cast<uint64_t>(cur);
+          carry = static_cast<uint64_t>(cur >> 64);
+        }
+        // Chỉ với i = 0 thì carry còn nằm trong k + 1 limb thấp
+        if (i == 0) {
+          r2[k] += carry;
+        }
+      }
+
+      // 4. r = (x mod b^(k+1)) - r2 theo modulo b^(k+1)
+      uint64_t r[5] = {0, 0, 0, 0, 0};
+      uint64_t borrow = 0;
+      for (size_t i = 0; i <= k; ++i) {
+        uint128_t diff = static_cast<uint128_t>(xl[i]) - r2[i] - borrow;
+        r[i] = static_cast<uint64_t>(diff);
+        borrow = static_cast<uint64_t>(diff >> 64) != 0 ? 1 : 0;
+      }
+
+      // 5. r < 3n, trừ n tối đa hai lần
+      for (int round = 0; round < 2; ++round) {
+        bool ge = r[k] != 0;
+        if (!ge) {
+          ge = true;
+          for (size_t i = k; i-- > 0;) {
+            if (r[i] != nl[i]) {
+              ge = r[i] > nl[i];
+              break;
+            }
+          }
+        }
+        if (!ge) {
+          break;
+        }
+        borrow = 0;
+        for (size_t i = 0; i <= k; ++i) {
+          uint64_t sub = i < k ? nl[i] : 0;
+          uint128_t diff = static_cast<uint128_t>(r[i]) - sub - borrow;
+          r[i] = static_cast<uint64_t>(diff);
+          borrow = static_cast<uint64_t>(diff >> 64) != 0 ? 1 : 0;
+        }
+      }
+
+      U256 result;
+      for (size_t i = 0; i < k; ++i) {
+        result.limbs()[i] = r[i];
+      }
+      return result;
+    }
+
+    Scalar ScalarField::fromBigInt(const BigInt &value) const {
+      if (value.bit_length() <= 512) {
+        return Scalar(*this, reduce(U512(value)));
+      }
+      return Scalar(*this, U256(value % n_big_));
+    }
+
+    Scalar ScalarField::fromUint64(uint64_t value) const {
+      return Scalar(*this, reduce(U512(value)));
+    }
+
+    Scalar ScalarField::fromHash(const std::vector<uint8_t> &digest) const {
+      if (digest.size() > 64) {
+        throw std::invalid_argument("Hash digest longer than 64 bytes");
+      }
+      // Đọc digest big-endian thẳng vào các limb của một số 512-bit
+      U512 wide;
+      for (size_t i = 0; i < digest.size(); ++i) {
+        wide.limbs()[i / 8] |= static_cast<uint64_t>(
+                                   digest[digest.size() - 1 - i])
+            << ((i % 8) * 8);
+      }
+      return Scalar(*this, reduce(wide));
+    }
+
+    Scalar ScalarField::zero() const {
+      return Scalar(*this, U256());
+    }
+
+    Scalar ScalarField::one() const {
+      return Scalar(*this, U256(1));
+    }
+
+    Scalar Scalar::operator+(const Scalar &rhs) const {
+      Scalar result = *this;
+      result += rhs;
+      return result;
+    }
+
+    Scalar Scalar::operator-(const Scalar &rhs) const {
+      Scalar result = *this;
+      result -= rhs;
+      return result;
+    }
+
+    Scalar Scalar::operator*(const Scalar &rhs) const {
+      Scalar result = *this;
+      result *= rhs;
+      return result;
+    }
+
+    Scalar Scalar::operator-() const {
+      if (isZero()) {
+        return *this;
+      }
+      return Scalar(*field_, field_->order() - v_);
+    }
+
+    Scalar &Scalar::operator+=(const Scalar &rhs) {
+      // a + b < 2n; nếu tràn 2^256 thì chắc chắn >= n
+      if (v_.addCarry(rhs.v_) != 0 || v_ >= field_->order()) {
+        v_ -= field_->order();
+      }
+      return *this;
+    }
+
+    Scalar &Scalar::operator-=(const Scalar &rhs) {
+      if (v_.subBorrow(rhs.v_) != 0) {
+        v_ += field_->order();
+      }
+      return *this;
+    }
+
+    Scalar &Scalar::operator*=(const Scalar &rhs) {
+      v_ = field_->reduce(mulWide(v_, rhs.v_));
+      return *this;
+    }
+
+    Scalar Scalar::pow(const U256 &exp) const {
+      Scalar result = field_->one();
+      slidingWindowPow(
+          result,
+          *this,
+          exp,
+          [](Scalar &x) { x *= x; },
+          [](Scalar &x, const Scalar &y) { x *= y; });
+      return result;
+    }
+
+    Scalar Scalar::inverse() const {
+      if (isZero()) {
+        throw std::invalid_argument("k is 0");
+      }
+      const U256 &n = field_->order();
+      U256 result;
+      bool invertible;
+      if (n.test_bit(0)) {
+        invertible = tryInverseMod(v_, n, result);
+      } else {
+        BigInt inverse;
+        invertible = tryInverseMod(v_.toBigInt(), n.toBigInt(), inverse);
+        result = U256(inverse);
+      }
+      if (!invertible) {
+        throw std::invalid_argument("k has no inverse modulo n");
+      }
+      return Scalar(*field_, result);
+    }
+
+    std::vector<Scalar> batchInverse(const std::vector<Scalar> &values) {
+      if (values.empty()) {
+        return {};
+      }
+      // prefix[i] = values[0] * ... * values[i]
+      std::vector<Scalar> prefix;
+      prefix.reserve(values.size());
+      prefix.push_back(values[0]);
+      for (size_t i = 1; i < values.size(); ++i) {
+        prefix.push_back(prefix.back() * values[i]);
+      }
+
+      std::vector<Scalar> result(values);
+      Scalar inv = prefix.back().inverse();
+      for (size_t i = values.size(); i-- > 1;) {
+        result[i] = inv * prefix[i - 1];
+        inv *= values[i];
+      }
+      result[0] = inv;
+      return result;
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
@@ -0,0 +1,152 @@
+#ifndef SCALAR_HPP
+#define SCALAR_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "bigInt.hpp"
+#include "uint.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    class Scalar;
+
+    /*
+     * Ngữ cảnh số học modulo bậc n của nhóm (trường Z_n), dùng rút gọn
+     * Barrett để không cần phép chia khi nhân.
+     * @note n phải có tối đa 256 bit
+     * @note mu = floor(2^(128 * k) / n) với k là số limb 64-bit của n
+     */
+    class ScalarField {
+     public:
+      /*
+       * Constructor cho trường Z_n
+       * @param order Bậc n của nhóm
+       * @throws std::invalid_argument nếu n < 2 hoặc n có hơn 256 bit
+       */
+      explicit ScalarField(const BigInt &order);
+
+      const U256 &order() const {
+        return n_;
+      }
+
+      /*
+       * Hàm rút gọn một số 512-bit theo modulo n
+       * @param x Số cần rút gọn
+       * @return x mod n
+       */
+      U256 reduce(const U512 &x) const;
+
+      /*
+       * Hàm tạo Scalar từ một BigInt bất kỳ
+       * @param value Giá trị, được rút gọn mod n
+       * @return Scalar tương ứng
+       */
+      Scalar fromBigInt(const BigInt &value) const;
+
+      /*
+       * Hàm tạo Scalar từ uint64_t
+       * @param value Giá trị, được rút gọn mod n
+       * @return Scalar tương ứng
+       */
+      Scalar fromUint64(uint64_t value) const;
+
+      /*
+       * Hàm rút gọn trực tiếp một giá trị băm thành Scalar
+       * @param digest Giá trị băm big-endian (32 hoặc 64 byte)
+       * @return digest mod n
+       * @throws std::invalid_argument nếu digest dài hơn 64 byte
+       */
+      Scalar fromHash(const std::vector<uint8_t> &digest) const;
+
+      Scalar zero() const;
+      Scalar one() const;
+
+     private:
+      U256 n_;          // Bậc của nhóm
+      size_t k_;        // Số limb 64-bit của n
+      UInt<320> mu_;    // floor(2^(128 * k) / n), tối đa k + 1 limb
+      BigInt n_big_;    // n dạng BigInt, dùng khi đầu vào quá lớn cho Barrett
+    };
+
+    /*
+     * Phần tử của Z_n gắn với một ScalarField.
+     * @note ScalarField phải tồn tại lâu hơn các Scalar được tạo từ nó
+     * @note Giá trị luôn được lưu ở dạng đã rút gọn, trong [0, n)
+     */
+    class Scalar {
+     public:
+      Scalar(const ScalarField &field, const U256 &value)
+          : field_(&field), v_(value) {}
+
+      const U256 &value() const {
+        return v_;
+      }
+
+      BigInt toBigInt() const {
+        return v_.toBigInt();
+      }
+
+      bool isZero() const {
+        return v_.isZero();
+      }
+
+      // Arithmetic operators (mod n)
+      Scalar operator+(const Scalar &rhs) const;
+      Scalar operator-(const Scalar &rhs) const;
+      Scalar operator*(const Scalar &rhs) const;
+      Scalar operator-() const;
+
+      Scalar &operator+=(const Scalar &rhs);
+      Scalar &operator-=(const Scalar &rhs);
+      Scalar &operator*=(const Scalar &rhs);
+
+      /*
+       * Hàm tính nghịch đảo mod n
+       * @return this^-1 mod n
+       * @throws std::invalid_argument nếu phần tử bằng 0 hoặc không có
+       * nghịch đảo mod n
+       * @note Dùng Euclid nhị phân (tryInverseMod)
+       */
+      Scalar inverse() const;
+
+      /*
+       * Hàm lũy thừa
+       * @param exp Số mũ
+       * @return this^exp mod n
+       */
+      Scalar pow(const U256 &exp) const;
+
+      // Comparison operators
+      bool operator==(const Scalar &rhs) const {
+        return v_ == rhs.v_;
+      }
+      bool operator!=(const Scalar &rhs) const {
+        return v_ != rhs.v_;
+      }
+
+      // Debug
+      friend std::ostream &operator<<(std::ostream &os, const Scalar &s) {
+        return os << s.v_;
+      }
+
+     private:
+      const ScalarField *field_;
+      U256 v_;
+    };
+
+    /*
+     * Hàm nghịch đảo nhiều phần tử cùng lúc (Montgomery's trick)
+     * @param values Các phần tử cùng một ScalarField
+     * @return values[i]^-1 mod n theo đúng thứ tự
+     * @note Chỉ một phép nghịch đảo cộng 3(k - 1) phép nhân cho k phần tử
+     * @throws std::invalid_argument nếu có phần tử bằng 0
+     */
+    std::vector<Scalar> batchInverse(const std::vector<Scalar> &values);
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // SCALAR_HPP
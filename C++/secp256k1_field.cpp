@@ -0,0 +1,188 @@
+#include "secp256k1_field.hpp"
+
+#include <stdexcept>
+
+#include "modinv.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    namespace {
+      // 2^256 mod p = 2^32 + 977
+      const uint64_t kReductionConstant = 0x1000003D1ULL;
+
+      const U256 kPrime = U256::from_hex(
+          "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F");
+
+      // 2^512 mod p = (2^32 + 977)^2, dùng để gấp phần tràn của WideSum
+      const U256 kWideFold = U256::from_hex("0x01000007A2000E90A1");
+    }  // namespace
+
+    Secp256k1Field::Secp256k1Field(const U256 &value) : v_(value) {
+      // value < 2^256 < 2p nên chỉ cần trừ p tối đa một lần
+      if (v_ >= kPrime) {
+        v_ -= kPrime;
+      }
+    }
+
+    Secp256k1Field::Secp256k1Field(const BigInt &value) {
+      if (value.bit_length() <= 256) {
+        *this = Secp256k1Field(U256(value));
+      } else {
+        v_ = U256(value % kPrime.toBigInt());
+      }
+    }
+
+    const U256 &Secp256k1Field::modulus() {
+      return kPrime;
+    }
+
+    bool Secp256k1Field::isModulus(const BigInt &p) {
+      return p.bit_length() == 256 && U256(p) == kPrime;
+    }
+
+    U256 Secp256k1Field::reduce(const U512 &wide) {
+      const auto &w = wide.limbs();
+
+      // 1. t = lo + hi * (2^32 + 977), kết quả có 5 limb, limb cao < 2^34
+      uint64_t t[5];
+      uint64_t carry = 0;
+      for (size_t i = 0; i < 4; ++i) {
+        uint128_t cur = static_cast<uint128_t>(w[i + 4]) * kReductionConstant
+            + w[i] + carry;
+        t[i] = static_cast<uint64_t>(cur);
+        carry = static_cast<uint64_t>(cur >> 64);
+      }
+      t[4] = carry;
+
+      // 2. Gấp limb cao thêm một lần: t = t[0..3] + t[4] * (2^32 + 977)
+      U256 result;
+      auto &r = result.limbs();
+      uint128_t cur = static_cast<uint128_t>(t[4]) * kReductionConstant + t[0];
+      r[0] = static_cast<uint64_t>(cur);
+      carry = static_cast<uint64_t>(cur >> 64);
+      for (size_t i = 1; i < 4; ++i) {
+        cur = static_cast<uint128_t>(t[i]) + carry;
+        r[i] = static_cast<uint64_t>(cur);
+        carry = static_cast<uint64_t>(cur >> 64);
+      }
+
+      // 3. Nếu còn tràn 2^256, phần thấp lúc này rất nhỏ nên cộng thêm
+      // 2^32 + 977 không thể tràn lần nữa
+      if (carry != 0) {
+        result += U256(kReductionConstant);
+      }
+
+      // 4. Kết quả < 2p, trừ p tối đa một lần
+      if (result >= kPrime) {
+        result -= kPrime;
+      }
+      return result;
+    }
+
+    Secp256k1Field Secp256k1Field::reduceWide(const WideSum &sum) {
+      Secp256k1Field result;
+      result.v_ = reduce(foldOverflow(sum, kWideFold));
+      return result;
+    }
+
+    Secp256k1Field Secp256k1Field::operator+(const Secp256k1Field &rhs) const {
+      Secp256k1Field result = *this;
+      result += rhs;
+      return result;
+    }
+
+    Secp256k1Field Secp256k1Field::operator-(const Secp256k1Field &rhs) const {
+      Secp256k1Field result = *this;
+      result -= rhs;
+      return result;
+    }
+
+    Secp256k1Field Secp256k1Field::operator*(const Secp256k1Field &rhs) const {
+      Secp256k1Field result;
+      result.v_ = reduce(mulWide(v_, rhs.v_));
+      return result;
+    }
+
+    Secp256k1Field Secp256k1Field::operator-() const {
+      Secp256k1Field result;
+      if (!isZero()) {
+        result.v_ = kPrime - v_;
+      }
+      return result;
+    }
+
+    Secp256k1Field &Secp256k1Field::operator+=(const Secp256k1Field &rhs) {
+      // a + b < 2p; nếu tràn 2^256 thì a + b - p = (a + b - 2^256) + c
+      if (v_.addCarry(rhs.v_) != 0) {
+        v_ += U256(kReductionConstant);
+      } else if (v_ >= kPrime) {
+        v_ -= kPrime;
+      }
+      return *this;
+    }
+
+    Secp256k1Field &Secp256k1Field::operator-=(const Secp256k1Field &rhs) {
+      // Nếu a < b thì a - b + p = (a - b + 2^256) - c
+      if (v_.subBorrow(rhs.v_) != 0) {
+        v_ -= U256(kReductionConstant);
+      }
+      return *this;
+    }
+
+    Secp256k1Field &Secp256k1Field::operator*=(const Secp256k1Field &rhs) {
+      v_ = reduce(mulWide(v_, rhs.v_));
+      return *this;
+    }
+
+    Secp256k1Field Secp256k1Field::sqr() const {
+      Secp256k1Field result;
+      result.v_ = reduce(sqrWide(v_));
+      return result;
+    }
+
+    Secp256k1Field Secp256k1Field::sqrTimes(size_t count) const {
+      Secp256k1Field result = *this;
+      for (size_t i = 0; i < count; ++i) {
+        result = result.sqr();
+      }
+      return result;
+    }
+
+    Secp256k1Field Secp256k1Field::inverse() const {
+      if (isZero()) {
+        throw std::invalid_argument("k is 0");
+      }
+      // Euclid nhị phân trên 4 limb, nhanh hơn nhiều so với this^(p-2)
+      Secp256k1Field result;
+      tryInverseMod(v_, kPrime, result.v_);
+      return result;
+    }
+
+    bool Secp256k1Field::sqrt(Secp256k1Field &root) const {
+      // Chuỗi cộng cố định cho (p + 1) / 4 (như libsecp256k1): xN là
+      // this^(2^N - 1); tổng cộng 253 phép bình phương và 13 phép nhân
+      const Secp256k1Field &a = *this;
+      Secp256k1Field x2 = a.sqr() * a;
+      Secp256k1Field x3 = x2.sqr() * a;
+      Secp256k1Field x6 = x3.sqrTimes(3) * x3;
+      Secp256k1Field x9 = x6.sqrTimes(3) * x3;
+      Secp256k1Field x11 = x9.sqrTimes(2) * x2;
+      Secp256k1Field x22 = x11.sqrTimes(11) * x11;
+      Secp256k1Field x44 = x22.sqrTimes(22) * x22;
+      Secp256k1Field x88 = x44.sqrTimes(44) * x44;
+      Secp256k1Field x176 = x88.sqrTimes(88) * x88;
+      Secp256k1Field x220 = x176.sqrTimes(44) * x44;
+      Secp256k1Field x223 = x220.sqrTimes(3) * x3;
+      Secp256k1Field candidate = x223.sqrTimes(23) * x22;
+      candidate = candidate.sqrTimes(6) * x2;
+      candidate = candidate.sqrTimes(2);
+      if (candidate.sqr() != *this) {
+        return false;
+      }
+      root = candidate;
+      return true;
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
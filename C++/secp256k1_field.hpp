@@ -0,0 +1,160 @@
+#ifndef SECP256K1_FIELD_HPP
+#define SECP256K1_FIELD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+#include "bigInt.hpp"
+#include "lazy_field.hpp"
+#include "uint.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Phần tử của trường hữu hạn Z_p với p = 2^256 - 2^32 - 977 (secp256k1).
+     * Vì 2^256 = 2^32 + 977 mod p nên phép rút gọn tích 512-bit chỉ cần vài
+     * phép nhân-cộng, không cần phép chia.
+     * @note Giá trị luôn được lưu ở dạng đã rút gọn, trong [0, p)
+     */
+    class Secp256k1Field {
+     public:
+      /*
+       * Constructor mặc định, giá trị 0
+       */
+      Secp256k1Field() = default;
+
+      /*
+       * Constructor từ uint64_t
+       * @param value Giá trị (luôn nhỏ hơn p)
+       */
+      explicit Secp256k1Field(uint64_t value) : v_(value) {}
+
+      /*
+       * Constructor từ U256
+       * @param value Giá trị bất kỳ, được rút gọn mod p
+       */
+      explicit Secp256k1Field(const U256 &value);
+
+      /*
+       * Constructor từ BigInt
+       * @param value Giá trị bất kỳ, được rút gọn mod p
+       */
+      explicit Secp256k1Field(const BigInt &value);
+
+      /*
+       * Hàm trả về số nguyên tố p của trường
+       * @return p = 2^256 - 2^32 - 977
+       */
+      static const U256 &modulus();
+
+      /*
+       * Kiểm tra xem p có phải là số nguyên tố của secp256k1 hay không
+       * @param p Số nguyên cần kiểm tra
+       * @return true nếu p = 2^256 - 2^32 - 977
+       */
+      static bool isModulus(const BigInt &p);
+
+      const U256 &value() const {
+        return v_;
+      }
+
+      BigInt toBigInt() const {
+        return v_.toBigInt();
+      }
+
+      bool isZero() const {
+        return v_.isZero();
+      }
+
+      bool isOdd() const {
+        return (v_.limbs()[0] & 1) != 0;
+      }
+
+      // Arithmetic operators (mod p)
+      Secp256k1Field operator+(const Secp256k1Field &rhs) const;
+      Secp256k1Field operator-(const Secp256k1Field &rhs) const;
+      Secp256k1Field operator*(const Secp256k1Field &rhs) const;
+      Secp256k1Field operator-() const;
+
+      Secp256k1Field &operator+=(const Secp256k1Field &rhs);
+      Secp256k1Field &operator-=(const Secp256k1Field &rhs);
+      Secp256k1Field &operator*=(const Secp256k1Field &rhs);
+
+      /*
+       * Hàm bình phương
+       * @return this^2 mod p
+       * @note Chỉ cần 10 phép nhân limb thay vì 16
+       */
+      Secp256k1Field sqr() const;
+
+      /*
+       * Hàm tính nghịch đảo
+       * @return this^-1 mod p
+       * @throws std::invalid_argument nếu phần tử bằng 0
+       * @note Dùng Euclid nhị phân (tryInverseMod), không dùng định lý Fermat
+       */
+      Secp256k1Field inverse() const;
+
+      /*
+       * Hàm tính căn bậc hai
+       * @param root Căn bậc hai (nếu tồn tại)
+       * @return true nếu phần tử là số chính phương mod p
+       * @note Vì p = 3 mod 4 nên root = this^((p + 1) / 4), tính bằng một
+       * chuỗi cộng cố định
+       */
+      bool sqrt(Secp256k1Field &root) const;
+
+      /*
+       * Hàm nhân không rút gọn, để cộng dồn nhiều tích trước khi rút gọn
+       * @return a * b dạng 512-bit (xem lazy_field.hpp)
+       */
+      static WideSum mulUnreduced(const Secp256k1Field &a,
+                                  const Secp256k1Field &b) {
+        return WideSum(mulWide(a.v_, b.v_));
+      }
+
+      /*
+       * Hàm rút gọn một tổng các tích chưa rút gọn
+       * @param sum Tổng chưa rút gọn
+       * @return sum mod p
+       */
+      static Secp256k1Field reduceWide(const WideSum &sum);
+
+      // Comparison operators
+      bool operator==(const Secp256k1Field &rhs) const {
+        return v_ == rhs.v_;
+      }
+      bool operator!=(const Secp256k1Field &rhs) const {
+        return v_ != rhs.v_;
+      }
+
+      // Debug
+      friend std::ostream &operator<<(std::ostream &os,
+                                      const Secp256k1Field &f) {
+        return os << f.v_;
+      }
+
+     private:
+      /*
+       * Hàm rút gọn một tích 512-bit về [0, p)
+       * @param wide Tích 512-bit
+       * @return wide mod p
+       */
+      static U256 reduce(const U512 &wide);
+
+      /*
+       * Hàm bình phương lặp, dùng cho chuỗi cộng của sqrt()
+       * @param count Số lần bình phương
+       * @return this^(2^count) mod p
+       */
+      Secp256k1Field sqrTimes(size_t count) const;
+
+      U256 v_;
+    };
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // SECP256K1_FIELD_HPP
@@ -0,0 +1,53 @@
+#include "secp256k1_glv.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    namespace {
+      const BigInt kOrder = BigInt::from_hex(
+          "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141");
+      const BigInt kHalfOrder = kOrder >> 1;
+
+      // Cơ sở lưới {(a1, b1), (a2, b2)} với a + b * lambda = 0 mod n
+      // (b1 âm, ở đây lưu -b1)
+      const BigInt kA1 = BigInt::from_hex("0x3086D221A7D46BCDE86C90E49284EB15");
+      const BigInt kMinusB1 =
+          BigInt::from_hex("0xE4437ED6010E88286F547FA90ABFE4C3");
+      const BigInt kA2 = BigInt::from_hex("0x0114CA50F7A8E2F3F657C1108D9D44CFD8");
+      const BigInt kB2 = kA1;
+
+      // |x - y| và dấu của x - y
+      BigInt signedDifference(const BigInt &x, const BigInt &y, bool &negative) {
+        negative = x < y;
+        return negative ? y - x : x - y;
+      }
+    }  // namespace
+
+    const BigInt &secp256k1Order() {
+      return kOrder;
+    }
+
+    const Secp256k1Field &secp256k1Beta() {
+      // Khởi tạo khi gọi lần đầu, sau khi các hằng số của Secp256k1Field đã sẵn
+      // sàng
+      static const Secp256k1Field beta(U256::from_hex(
+          "0x7AE96A2B657C07106E64479EAC3434E99CF0497512F58995C1396C28719501EE"));
+      return beta;
+    }
+
+    GlvSplit splitScalarSecp256k1(const BigInt &k) {
+      BigInt kr = k < kOrder ? k : k % kOrder;
+
+      // c1 = round(b2 * k / n), c2 = round(-b1 * k / n)
+      BigInt c1 = (kB2 * kr + kHalfOrder) / kOrder;
+      BigInt c2 = (kMinusB1 * kr + kHalfOrder) / kOrder;
+
+      // k1 = k - c1 * a1 - c2 * a2, k2 = -c1 * b1 - c2 * b2
+      GlvSplit split;
+      split.k1 = signedDifference(kr, c1 * kA1 + c2 * kA2, split.k1_negative);
+      split.k2 = signedDifference(c1 * kMinusB1, c2 * kB2, split.k2_negative);
+      return split;
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
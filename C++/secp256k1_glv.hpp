@@ -0,0 +1,48 @@
+#ifndef SECP256K1_GLV_HPP
+#define SECP256K1_GLV_HPP
+
+#include "bigInt.hpp"
+#include "secp256k1_field.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Endomorphism GLV của secp256k1: phi(x, y) = (beta * x, y) = lambda * (x, y)
+     * với beta^3 = 1 mod p và lambda^3 = 1 mod n.
+     * Nhờ đó k * P = k1 * P + k2 * phi(P) với |k1|, |k2| khoảng 128 bit, nên
+     * phép nhân chỉ cần khoảng một nửa số phép nhân đôi.
+     */
+
+    /*
+     * Kết quả tách k = k1 + k2 * lambda mod n, với k1, k2 có dấu
+     */
+    struct GlvSplit {
+      BigInt k1;  // |k1|
+      bool k1_negative;
+      BigInt k2;  // |k2|
+      bool k2_negative;
+    };
+
+    /*
+     * Hàm trả về bậc n của điểm sinh secp256k1 (cofactor = 1 nên mọi điểm
+     * khác vô cực đều có bậc n)
+     */
+    const BigInt &secp256k1Order();
+
+    /*
+     * Hàm trả về beta, căn bậc ba của 1 trong F_p dùng cho phi(x, y)
+     */
+    const Secp256k1Field &secp256k1Beta();
+
+    /*
+     * Hàm tách số nhân k theo cơ sở lưới của GLV
+     * @param k Số nguyên không âm (tự rút gọn mod n)
+     * @return k1, k2 sao cho k = k1 + k2 * lambda mod n, |k1|, |k2| < 2^128
+     */
+    GlvSplit splitScalarSecp256k1(const BigInt &k);
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // SECP256K1_GLV_HPP
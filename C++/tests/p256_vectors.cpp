@@ -0,0 +1,123 @@
+// Kiểm tra backend P-256 (P256Field, rút gọn Solinas, công thức a = -3)
+// với các vector chuẩn:
+//   - 2 * G
+//   - khóa công khai của RFC 6979 A.2.5
+//   - chữ ký SHA-256 của các thông điệp "sample" và "test" trong A.2.5
+// Chương trình in kết quả từng kiểm tra và trả về 1 nếu có kiểm tra sai.
+//
+// Biên dịch từ thư mục C++:
+//   g++ -std=c++17 -I. -DIROHA_CRYPTO_NO_UTILS_MAIN -o p256_vectors
+//       *.cpp tests/p256_vectors.cpp -lsodium
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "bigInt.hpp"
+#include "curve_registry.hpp"
+#include "ecdsa.hpp"
+#include "elliptic_curve.hpp"
+#include "point.hpp"
+
+using namespace shared_model::crypto;
+
+namespace {
+
+  int failures = 0;
+
+  void check(const std::string &name, bool ok) {
+    std::cout << (ok ? "PASS " : "FAIL ") << name << std::endl;
+    if (!ok) {
+      ++failures;
+    }
+  }
+
+  bool isPoint(const Point &P, const std::string &x, const std::string &y) {
+    return !P.isInfinity() && P.x() == BigInt::from_hex(x)
+        && P.y() == BigInt::from_hex(y);
+  }
+
+  // Chuỗi hex (không có "0x") thành các byte big-endian
+  std::vector<uint8_t> hexBytes(const std::string &hex) {
+    std::vector<uint8_t> bytes;
+    for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+      bytes.push_back(
+          static_cast<uint8_t>(std::stoi(hex.substr(i, 2), nullptr, 16)));
+    }
+    return bytes;
+  }
+
+  // Khóa công khai U = x * G của RFC 6979 A.2.5
+  const std::string kUx =
+      "0x60FED4BA255A9D31C961EB74C6356D68C049B8923B61FA6CE669622E60F29FB6";
+  const std::string kUy =
+      "0x7903FE1008B8BC99A41AE9E95628BC64F2F1B20C2D7E9F5177A3C294D4462299";
+
+  // Một chữ ký SHA-256 của RFC 6979 A.2.5
+  struct SignatureVector {
+    std::string message;
+    std::string hash;  // SHA-256(message)
+    std::string r;
+    std::string s;
+    int recid;  // Tính từ R = k * G của vector
+  };
+
+  const SignatureVector kSignatures[] = {
+      {"sample",
+       "af2bdbe1aa9b6ec1e2ade1d694f41fc71a831d0268e9891562113d8a62add1bf",
+       "0xEFD48B2AACB6A8FD1140DD9CD45E81D69D2C877B56AAF991C34D0EA84EAF3716",
+       "0xF7CB1C942D657C41D436C7A1B6E29F65F3E900DBB9AFF4064DC4AB2F843ACDA8",
+       0},
+      {"test",
+       "9f86d081884c7d659a2feaa0c55ad015a3bf4f1b2b0b822cd15d6c15b0f00a08",
+       "0xF1ABB023518351CD71D881567B1EA663ED3EFCF6C5132B354F28D3B0B7D38367",
+       "0x019F4113742A2B14BD25926B49C649155F267E60D3814B4C0CC84250E46F0083",
+       0},
+  };
+
+}  // namespace
+
+int main() {
+  EllipticCurve curve = namedCurve("P-256");
+  check("P-256 uses P256Field", curve.isP256());
+
+  // multiplyBase (bảng tiền tính) và multiply (wNAF) với cùng vector
+  const std::string x2 =
+      "0x7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978";
+  const std::string y2 =
+      "0x07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1";
+  check("multiplyBase(2)", isPoint(curve.multiplyBase(BigInt(2)), x2, y2));
+  check("multiply(G, 2)",
+        isPoint(curve.multiply(curve.G(), BigInt(2)), x2, y2));
+
+  const BigInt d = BigInt::from_hex(
+      "0xC9AFA9D845BA75166B5C215767B1D6934E50C3DB36E89B127B8A622B120F6721");
+  check("multiplyBase(d) = U", isPoint(curve.multiplyBase(d), kUx, kUy));
+  check("multiply(G, d) = U",
+        isPoint(curve.multiply(curve.G(), d), kUx, kUy));
+
+  const Point U(BigInt::from_hex(kUx), BigInt::from_hex(kUy));
+  check("U is on the curve", curve.isOnCurve(U));
+
+  for (const SignatureVector &v : kSignatures) {
+    const std::vector<uint8_t> hash = hexBytes(v.hash);
+    const BigInt r = BigInt::from_hex(v.r);
+    const BigInt s = BigInt::from_hex(v.s);
+
+    check("ecdsaVerify \"" + v.message + "\"",
+          ecdsaVerify(curve, U, hash, r, s));
+    check("ecdsaVerify \"" + v.message + "\" rejects s + 1",
+          !ecdsaVerify(curve, U, hash, r, s + BigInt(1)));
+
+    Point recovered;
+    check("ecdsaRecover \"" + v.message + "\"",
+          ecdsaRecover(curve, hash, r, s, v.recid, recovered)
+              && isPoint(recovered, kUx, kUy));
+  }
+
+  std::cout << (failures == 0 ? "All P-256 vectors passed"
+                              : "Some P-256 vectors failed")
+            << std::endl;
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,237 @@
+"""So sánh EllipticCurve / ecdsa với mô hình Python độc lập.
+
+Mô hình dùng công thức affine sách giáo khoa (một phép nghịch đảo cho mỗi
+phép cộng, nhân đôi-và-cộng từ bit cao), nên không chia sẻ gì với tọa độ
+Jacobian, rút gọn lười, wNAF, GLV, bảng tiền tính hay Pippenger của bản C++.
+Các trường hợp gồm secp256k1 (k1), P-256 (r1) và brainpoolP256r1 (bp, a
+tổng quát), với số nhân biên: 0, n - 1, n, n + 1, lambda của GLV và số
+ngẫu nhiên 256 bit (k >= n).
+
+Cách dùng:
+    python3 reference.py <đường dẫn reference_driver> [seed]
+In các dòng MISMATCH nếu có và trả về 1 nếu có sai khác.
+"""
+
+import hashlib
+import random
+import subprocess
+import sys
+
+CURVES = {
+    'k1': dict(
+        p=2**256 - 2**32 - 977, a=0, b=7,
+        gx=0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798,
+        gy=0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8,
+        n=0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141),
+    'r1': dict(
+        p=2**256 - 2**224 + 2**192 + 2**96 - 1, a=-3,
+        b=0x5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B,
+        gx=0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296,
+        gy=0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5,
+        n=0xFFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551),
+    'bp': dict(
+        p=0xA9FB57DBA1EEA9BC3E660A909D838D726E3BF623D52620282013481D1F6E5377,
+        a=0x7D5A0975FC2C3057EEF67530417AFFE7FB8055C126DC5C6CE94A4B44F330B5D9,
+        b=0x26DC5C6CE94A4B44F330B5D9BBD77CBF958416295CF7E1CE6BCCDC18FF8C07B6,
+        gx=0x8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262,
+        gy=0x547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997,
+        n=0xA9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A7),
+}
+
+# lambda của endomorphism GLV trên secp256k1: lambda * (x, y) = (beta * x, y)
+SECP256K1_LAMBDA = (
+    0x5363AD4CC05C30E0A5261C028812645A122E22EA20816678DF02967C1B23BD72)
+
+
+def add(c, P, Q):
+    p = c['p']
+    if P is None:
+        return Q
+    if Q is None:
+        return P
+    if P[0] == Q[0]:
+        if (P[1] + Q[1]) % p == 0:
+            return None
+        lam = (3 * P[0] * P[0] + c['a']) * pow(2 * P[1], -1, p) % p
+    else:
+        lam = (Q[1] - P[1]) * pow(Q[0] - P[0], -1, p) % p
+    x = (lam * lam - P[0] - Q[0]) % p
+    return (x, (lam * (P[0] - x) - P[1]) % p)
+
+
+def mul(c, P, k):
+    R = None
+    for bit in bin(k)[2:]:
+        R = add(c, R, R)
+        if bit == '1':
+            R = add(c, R, P)
+    return R
+
+
+def generator(c):
+    return (c['gx'], c['gy'])
+
+
+def hash_to_int(c, digest):
+    """Số bit bên trái của digest bằng số bit của n (như hashToScalar)."""
+    z = int.from_bytes(digest, 'big')
+    excess = len(digest) * 8 - c['n'].bit_length()
+    return z >> excess if excess > 0 else z
+
+
+def sign(c, d, digest, k):
+    """Chữ ký (r, s, recid) với nonce k, chuẩn hóa low-s."""
+    n = c['n']
+    R = mul(c, generator(c), k)
+    r = R[0] % n
+    s = pow(k, -1, n) * (hash_to_int(c, digest) + r * d) % n
+    recid = (R[1] & 1) | (2 if R[0] >= n else 0)
+    if s > n // 2:
+        s, recid = n - s, recid ^ 1
+    return r, s, recid
+
+
+def h(v):
+    return '%x' % v
+
+
+def fmt(P):
+    return 'INF' if P is None else '%x %x' % P
+
+
+def build_cases(rng):
+    cases = []
+
+    def case(cmd, expected):
+        cases.append((cmd, expected))
+
+    for name, c in CURVES.items():
+        n, p, g = c['n'], c['p'], generator(c)
+        ks = [0, 1, 2, 3, n - 1, n - 2, n, n + 1, 2**128, 2**255 - 19,
+              (n - 1) // 2, 2**256 - 1, rng.randrange(n), rng.randrange(n),
+              rng.randrange(2**256)]
+        if name == 'k1':
+            ks += [SECP256K1_LAMBDA, n - SECP256K1_LAMBDA,
+                   SECP256K1_LAMBDA + n]
+        for k in ks:
+            case(f'BASE {name} {h(k)}', fmt(mul(c, g, k % n)))
+        for _ in range(6):
+            P = mul(c, g, rng.randrange(1, n))
+            for w in (2, 4, 5, 8):
+                k = rng.randrange(2**256)
+                case(f'MUL {name} {h(P[0])} {h(P[1])} {h(k)} {w}',
+                     fmt(mul(c, P, k % n)))
+            for k in ks:
+                case(f'MUL {name} {h(P[0])} {h(P[1])} {h(k)} 5',
+                     fmt(mul(c, P, k % n)))
+            k, l = rng.randrange(n), rng.randrange(n)
+            case(f'BAP {name} {h(k)} {h(P[0])} {h(P[1])} {h(l)}',
+                 fmt(add(c, mul(c, g, k), mul(c, P, l))))
+            case(f'BAP {name} {h(k)} {h(g[0])} {h(g[1])} {h((n - k) % n)}',
+                 'INF')
+            case(f'BAP {name} {h(k)} {h(g[0])} {h(g[1])} {h(k)}',
+                 fmt(mul(c, g, 2 * k % n)))
+            Q = mul(c, g, rng.randrange(1, n))
+            case(f'ADD {name} {h(P[0])} {h(P[1])} {h(Q[0])} {h(Q[1])}',
+                 fmt(add(c, P, Q)))
+            case(f'ADD {name} {h(P[0])} {h(P[1])} {h(P[0])} {h(P[1])}',
+                 fmt(add(c, P, P)))
+            case(f'ADD {name} {h(P[0])} {h(P[1])} {h(P[0])} {h(-P[1] % p)}',
+                 'INF')
+            case(f'RID {name} {h(P[0])} {h(P[1])}',
+                 str((P[1] & 1) | (2 if P[0] >= n else 0)))
+            case(f'ONC {name} {h(P[0])} {h(P[1])}', '1')
+            case(f'ONC {name} {h(P[0])} {h((P[1] + 1) % p)}', '0')
+            case(f'LIFT {name} {h(P[0])} {P[1] & 1}', fmt(P))
+            case(f'LIFT {name} {h(P[0])} {1 - (P[1] & 1)}',
+                 fmt((P[0], -P[1] % p)))
+        for m in (1, 2, 3, 7, 130):
+            base = [mul(c, g, rng.randrange(1, n)) for _ in range(min(m, 4))]
+            pts = [base[i % len(base)] for i in range(m)]
+            scalars = [rng.randrange(n) for _ in range(m)]
+            if m == 3:
+                scalars[2] = 0
+            R = None
+            for P, s in zip(pts, scalars):
+                R = add(c, R, mul(c, P, s))
+            case(f'MSM {name} {m} ' + ' '.join(
+                f'{h(P[0])} {h(P[1])} {h(s)}' for P, s in zip(pts, scalars)),
+                fmt(R))
+            R = None
+            for P in pts:
+                R = add(c, R, P)
+            case(f'SUM {name} {m} ' + ' '.join(
+                f'{h(P[0])} {h(P[1])}' for P in pts), fmt(R))
+
+        entries = []
+        for i in range(8):
+            d = rng.randrange(1, n)
+            Q = mul(c, g, d)
+            digest = (hashlib.sha256 if i % 2 else hashlib.sha512)(
+                bytes([i])).digest()
+            r, s, recid = sign(c, d, digest, rng.randrange(1, n))
+            hx = digest.hex()
+            pub = f'{h(Q[0])} {h(Q[1])}'
+            case(f'VER {name} {pub} {hx} {h(r)} {h(s)}', '1')
+            case(f'VER {name} {pub} {hx} {h(r)} {h(n - s)}', '1')
+            case(f'VER {name} {pub} {hx} {h(r)} {h((s + 1) % n)}', '0')
+            case(f'VER {name} {pub} {hx} {h(0)} {h(s)}', '0')
+            case(f'VER {name} {pub} {hx} {h(r)} {h(n)}', '0')
+            case(f'REC {name} {hx} {h(r)} {h(s)} {recid}', fmt(Q))
+            case(f'REC {name} {hx} {h(r)} {h(n - s)} {recid ^ 1}', fmt(Q))
+            entries.append((Q, hx, r, s, recid))
+
+        def batch(es, bad):
+            body = ' '.join(f'{h(Q[0])} {h(Q[1])} {hx} {h(r)} {h(s)} {rid}'
+                            for Q, hx, r, s, rid in es)
+            return (f'BATCH {name} {len(es)} {body}',
+                    ''.join(f'{i} ' for i in bad) + '|')
+
+        case(*batch(entries, []))
+        tampered = list(entries)
+        Q, hx, r, s, rid = tampered[3]
+        tampered[3] = (Q, hx, r, (s + 1) % n, rid)
+        case(*batch(tampered, [3]))
+        case(*batch([(Q, hx, r, s, -1) for Q, hx, r, s, _ in entries], []))
+        flipped = list(entries)
+        Q, hx, r, s, rid = flipped[5]
+        flipped[5] = (Q, hx, r, s, rid ^ 1)
+        case(*batch(flipped, []))
+        case(*batch([], []))
+    return cases
+
+
+def same(got, expected):
+    if got.lower() == expected.lower():
+        return True
+    # to_hex() có thể thêm "0x" và số 0 ở đầu
+    try:
+        return ' '.join('%x' % int(t, 16) for t in got.split()) == expected
+    except ValueError:
+        return False
+
+
+def main():
+    driver = sys.argv[1]
+    seed = int(sys.argv[2]) if len(sys.argv) > 2 else 1
+    cases = build_cases(random.Random(seed))
+    proc = subprocess.run([driver],
+                          input='\n'.join(cmd for cmd, _ in cases) + '\n',
+                          capture_output=True, text=True, check=True)
+    got = proc.stdout.splitlines()
+    bad = 0
+    if len(got) != len(cases):
+        print(f'expected {len(cases)} lines, got {len(got)}')
+        bad += 1
+    for (cmd, expected), line in zip(cases, got):
+        if not same(line, expected):
+            bad += 1
+            print('MISMATCH', cmd[:90])
+            print('  expected', expected[:100])
+            print('  got     ', line[:100])
+    print(f'{len(cases)} cases, {bad} mismatches (seed {seed})')
+    return 1 if bad else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,203 @@
+// Chương trình đọc lệnh từ stdin, mỗi dòng một lệnh, gọi các hàm của
+// EllipticCurve / ecdsa và in kết quả; reference.py sinh lệnh và so kết quả
+// với mô hình Python độc lập (công thức affine sách giáo khoa).
+//
+// Lệnh (số ở dạng hex không có "0x", <c> là k1 | r1 | bp):
+//   BASE <c> k                 multiplyBase(k)
+//   MUL <c> x y k w            multiply((x, y), k, w)
+//   BAP <c> k x y l            multiplyBaseAndPoint(k, (x, y), l)
+//   ADD <c> x1 y1 x2 y2        add()
+//   MSM <c> m (x y k)*m        multiScalarMultiply()
+//   SUM <c> m (x y)*m          sumPoints()
+//   ONC <c> x y                isOnCurve()
+//   LIFT <c> x odd             liftX()
+//   VER <c> x y hash r s       ecdsaVerify()
+//   REC <c> hash r s recid     ecdsaRecover()
+//   RID <c> x y                ecdsaRecoveryId()
+//   BATCH <c> m (x y hash r s recid)*m   ecdsaVerifyBatch()
+// Điểm được in là "x y" hoặc "INF".
+//
+// Biên dịch từ thư mục C++:
+//   g++ -std=c++17 -I. -DIROHA_CRYPTO_NO_UTILS_MAIN -o reference_driver
+//       *.cpp tests/reference/reference_driver.cpp -lsodium
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "bigInt.hpp"
+#include "curve_registry.hpp"
+#include "ecdsa.hpp"
+#include "elliptic_curve.hpp"
+#include "point.hpp"
+
+using namespace shared_model::crypto;
+
+namespace {
+
+  BigInt hex(const std::string &s) {
+    std::string digits = s.size() % 2 == 0 ? s : "0" + s;
+    return BigInt::from_hex("0x" + digits);
+  }
+
+  std::vector<uint8_t> hexBytes(const std::string &s) {
+    std::vector<uint8_t> bytes;
+    for (size_t i = 0; i + 1 < s.size(); i += 2) {
+      bytes.push_back(
+          static_cast<uint8_t>(std::stoi(s.substr(i, 2), nullptr, 16)));
+    }
+    return bytes;
+  }
+
+  Point readPoint(std::istream &in) {
+    std::string x;
+    std::string y;
+    in >> x >> y;
+    return Point(hex(x), hex(y));
+  }
+
+  BigInt readBigInt(std::istream &in) {
+    std::string s;
+    in >> s;
+    return hex(s);
+  }
+
+  void printPoint(const Point &P) {
+    if (P.isInfinity()) {
+      std::cout << "INF" << std::endl;
+    } else {
+      std::cout << P.x().to_hex() << " " << P.y().to_hex() << std::endl;
+    }
+  }
+
+  // brainpoolP256r1: a khác 0 và -3, dùng backend Montgomery tổng quát
+  CurveParams brainpoolP256r1() {
+    return {"brainpoolP256r1",
+            BigInt::from_hex("0xA9FB57DBA1EEA9BC3E660A909D838D726E3BF623D5262028"
+                             "2013481D1F6E5377"),
+            BigInt::from_hex("0x7D5A0975FC2C3057EEF67530417AFFE7FB8055C126DC5C6C"
+                             "E94A4B44F330B5D9"),
+            BigInt::from_hex("0x26DC5C6CE94A4B44F330B5D9BBD77CBF958416295CF7E1CE"
+                             "6BCCDC18FF8C07B6"),
+            BigInt::from_hex("0x8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C2"
+                             "3A4453BD9ACE3262"),
+            BigInt::from_hex("0x547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E54"
+                             "5C1D54C72F046997"),
+            BigInt::from_hex("0xA9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7"
+                             "901E0E82974856A7"),
+            1};
+  }
+
+  void run(const std::string &op, const EllipticCurve &E, std::istream &in) {
+    if (op == "BASE") {
+      printPoint(E.multiplyBase(readBigInt(in)));
+    } else if (op == "MUL") {
+      Point P = readPoint(in);
+      BigInt k = readBigInt(in);
+      size_t w;
+      in >> w;
+      printPoint(E.multiply(P, k, w));
+    } else if (op == "BAP") {
+      BigInt k = readBigInt(in);
+      Point P = readPoint(in);
+      printPoint(E.multiplyBaseAndPoint(k, P, readBigInt(in)));
+    } else if (op == "ADD") {
+      Point P = readPoint(in);
+      printPoint(E.add(P, readPoint(in)));
+    } else if (op == "MSM" || op == "SUM") {
+      size_t m;
+      in >> m;
+      std::vector<Point> points;
+      std::vector<BigInt> scalars;
+      for (size_t i = 0; i < m; ++i) {
+        points.push_back(readPoint(in));
+        if (op == "MSM") {
+          scalars.push_back(readBigInt(in));
+        }
+      }
+      printPoint(op == "MSM" ? E.multiScalarMultiply(points, scalars)
+                             : E.sumPoints(points));
+    } else if (op == "ONC") {
+      std::cout << E.isOnCurve(readPoint(in)) << std::endl;
+    } else if (op == "LIFT") {
+      BigInt x = readBigInt(in);
+      int odd;
+      in >> odd;
+      Point P;
+      if (E.liftX(x, odd != 0, P)) {
+        printPoint(P);
+      } else {
+        std::cout << "NONE" << std::endl;
+      }
+    } else if (op == "VER") {
+      Point Q = readPoint(in);
+      std::string hash;
+      in >> hash;
+      BigInt r = readBigInt(in);
+      BigInt s = readBigInt(in);
+      std::cout << ecdsaVerify(E, Q, hexBytes(hash), r, s) << std::endl;
+    } else if (op == "REC") {
+      std::string hash;
+      in >> hash;
+      BigInt r = readBigInt(in);
+      BigInt s = readBigInt(in);
+      int recid;
+      in >> recid;
+      Point Q;
+      if (ecdsaRecover(E, hexBytes(hash), r, s, recid, Q)) {
+        printPoint(Q);
+      } else {
+        std::cout << "NONE" << std::endl;
+      }
+    } else if (op == "RID") {
+      std::cout << ecdsaRecoveryId(E, readPoint(in)) << std::endl;
+    } else if (op == "BATCH") {
+      size_t m;
+      in >> m;
+      std::vector<EcdsaBatchEntry> entries;
+      for (size_t i = 0; i < m; ++i) {
+        EcdsaBatchEntry e;
+        e.pubkey = readPoint(in);
+        std::string hash;
+        in >> hash;
+        e.msgHash = hexBytes(hash);
+        e.r = readBigInt(in);
+        e.s = readBigInt(in);
+        in >> e.recid;
+        entries.push_back(e);
+      }
+      for (size_t i : ecdsaVerifyBatch(E, entries)) {
+        std::cout << i << " ";
+      }
+      std::cout << "|" << std::endl;
+    } else {
+      throw std::invalid_argument("Unknown command " + op);
+    }
+  }
+
+}  // namespace
+
+int main() {
+  std::map<std::string, EllipticCurve> curves;
+  curves.emplace("k1", namedCurve("secp256k1"));
+  curves.emplace("r1", namedCurve("P-256"));
+  curves.emplace("bp", EllipticCurve(brainpoolP256r1()));
+
+  std::string line;
+  while (std::getline(std::cin, line)) {
+    std::istringstream in(line);
+    std::string op;
+    std::string name;
+    in >> op >> name;
+    try {
+      run(op, curves.at(name), in);
+    } catch (const std::exception &e) {
+      std::cout << "EXC " << e.what() << std::endl;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,158 @@
+// Kiểm tra phép nhân GLV của secp256k1 (splitScalarSecp256k1, secp256k1Beta)
+// bằng cách so EllipticCurve::multiply (đi qua GLV) với:
+//   - wNAF một số nhân không dùng GLV (Curve<Secp256k1FieldOps>::multiply)
+//   - nhân đôi-và-cộng bằng EllipticCurve::add (affine, không dùng wNAF)
+// với k = 0, 1, lambda, n - lambda, n - 1, n, n + 1, 2^256 - 1 và k ngẫu nhiên
+// (gồm k >= n). Cũng kiểm tra k = k1 + k2 * lambda mod n, |k1|, |k2| < 2^128
+// và lambda * G = (beta * Gx, Gy). Cuối cùng in thời gian của hai đường nhân.
+// Chương trình trả về 1 nếu có kiểm tra sai.
+//
+// Biên dịch từ thư mục C++ (nên bật -O2 khi đo thời gian):
+//   g++ -std=c++17 -O2 -I. -DIROHA_CRYPTO_NO_UTILS_MAIN -o secp256k1_glv_check
+//       *.cpp tests/secp256k1_glv_check.cpp -lsodium
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "bigInt.hpp"
+#include "curve.hpp"
+#include "curve_registry.hpp"
+#include "elliptic_curve.hpp"
+#include "field_ops.hpp"
+#include "jacobian.hpp"
+#include "point.hpp"
+#include "secp256k1_glv.hpp"
+#include "utils.hpp"
+
+using namespace shared_model::crypto;
+
+namespace {
+
+  int failures = 0;
+
+  void check(const std::string &name, bool ok) {
+    std::cout << (ok ? "PASS " : "FAIL ") << name << std::endl;
+    if (!ok) {
+      ++failures;
+    }
+  }
+
+  bool samePoints(const Point &P, const Point &Q) {
+    if (P.isInfinity() || Q.isInfinity()) {
+      return P.isInfinity() && Q.isInfinity();
+    }
+    return P.x() == Q.x() && P.y() == Q.y();
+  }
+
+  const BigInt kLambda = BigInt::from_hex(
+      "0x5363AD4CC05C30E0A5261C028812645A122E22EA20816678DF02967C1B23BD72");
+
+  // k * P bằng wNAF trên Secp256k1Field, không tách GLV
+  Point multiplyWithoutGlv(const Point &P, const BigInt &k) {
+    Secp256k1FieldOps F;
+    Curve<Secp256k1FieldOps> C(F, BigInt(7));
+    return toAffinePoint(F,
+                         C.multiply(toFieldAffine(F, P),
+                                    k % secp256k1Order(),
+                                    EllipticCurve::kDefaultWnafWindow));
+  }
+
+  // k * P bằng nhân đôi-và-cộng từ bit cao với EllipticCurve::add
+  Point multiplyByAdd(const EllipticCurve &curve, const Point &P, BigInt k) {
+    k = k % curve.order();
+    Point R;
+    for (size_t i = k.bit_length(); i-- > 0;) {
+      R = curve.add(R, R);
+      if (k.test_bit(i)) {
+        R = curve.add(R, P);
+      }
+    }
+    return R;
+  }
+
+  // k1 + k2 * lambda mod n với dấu của GlvSplit
+  BigInt recombine(const GlvSplit &split) {
+    const BigInt &n = secp256k1Order();
+    BigInt k1 = split.k1 % n;
+    BigInt k2 = (split.k2 * kLambda) % n;
+    BigInt sum = split.k1_negative ? negMod(k1, n) : k1;
+    return addMod(sum, split.k2_negative ? negMod(k2, n) : k2, n);
+  }
+
+  template <class Fn>
+  double microsecondsPerCall(size_t iterations, Fn &&fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+      fn();
+    }
+    std::chrono::duration<double, std::micro> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / static_cast<double>(iterations);
+  }
+
+}  // namespace
+
+int main() {
+  EllipticCurve curve = namedCurve("secp256k1");
+  const BigInt &n = curve.order();
+  const BigInt max256 = (BigInt(1) << 256) - BigInt(1);
+
+  const Point &G = curve.G();
+  Point lambdaG = curve.multiply(G, kLambda);
+  BigInt betaGx = (Secp256k1Field(G.x()) * secp256k1Beta()).toBigInt();
+  check("lambda * G = (beta * Gx, Gy)",
+        !lambdaG.isInfinity() && lambdaG.x() == betaGx
+            && lambdaG.y() == G.y());
+
+  std::vector<std::pair<std::string, BigInt>> scalars = {
+      {"0", BigInt(0)},
+      {"1", BigInt(1)},
+      {"lambda", kLambda},
+      {"n - lambda", n - kLambda},
+      {"n - 1", n - BigInt(1)},
+      {"n", n},
+      {"n + 1", n + BigInt(1)},
+      {"2^256 - 1", max256},
+  };
+  for (int i = 0; i < 4; ++i) {
+    scalars.push_back({"random " + std::to_string(i),
+                       secureRandom(BigInt(0), max256)});
+  }
+
+  std::vector<Point> points = {G, curve.multiplyBase(secureRandom(
+                                      BigInt(1), n - BigInt(1)))};
+  for (const auto &[name, k] : scalars) {
+    GlvSplit split = splitScalarSecp256k1(k);
+    check("split " + name + ": k1 + k2 * lambda = k mod n",
+          recombine(split) == k % n);
+    check("split " + name + ": |k1|, |k2| < 2^128",
+          split.k1.bit_length() <= 128 && split.k2.bit_length() <= 128);
+
+    for (size_t j = 0; j < points.size(); ++j) {
+      const Point &P = points[j];
+      Point glv = curve.multiply(P, k);
+      std::string label = "P" + std::to_string(j) + " * " + name;
+      check(label + ": GLV = wNAF", samePoints(glv, multiplyWithoutGlv(P, k)));
+      check(label + ": GLV = double-and-add",
+            samePoints(glv, multiplyByAdd(curve, P, k)));
+    }
+  }
+
+  // Thời gian của hai đường nhân với cùng một điểm và số nhân
+  const Point &P = points[1];
+  const BigInt k = secureRandom(BigInt(1), n - BigInt(1));
+  const size_t iterations = 500;
+  double glv_us =
+      microsecondsPerCall(iterations, [&] { curve.multiply(P, k); });
+  double wnaf_us =
+      microsecondsPerCall(iterations, [&] { multiplyWithoutGlv(P, k); });
+  std::cout << "multiply: GLV " << glv_us << " us, wNAF without GLV "
+            << wnaf_us << " us" << std::endl;
+
+  std::cout << (failures == 0 ? "All GLV checks passed"
+                              : "Some GLV checks failed")
+            << std::endl;
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,174 @@
+// Kiểm tra ECDSA trên secp256k1 (ecdsaVerify, ecdsaVerifyBatch, ecdsaRecover)
+// với các vector đã biết:
+//   - d = 1, SHA-256 của "Satoshi Nakamoto" và "All those moments ...":
+//     vector RFC 6979 secp256k1 được công bố rộng rãi (python-ecdsa, trezor),
+//     s đã chuẩn hóa low-s
+//   - d = n - 1 (Q = -G), "Satoshi Nakamoto": k của cùng bộ vector, r và s
+//     được tính lại bằng tests/reference/reference.py
+// Chương trình in kết quả từng kiểm tra và trả về 1 nếu có kiểm tra sai.
+//
+// Biên dịch từ thư mục C++:
+//   g++ -std=c++17 -I. -DIROHA_CRYPTO_NO_UTILS_MAIN -o secp256k1_vectors
+//       *.cpp tests/secp256k1_vectors.cpp -lsodium
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "bigInt.hpp"
+#include "curve_registry.hpp"
+#include "ecdsa.hpp"
+#include "elliptic_curve.hpp"
+#include "point.hpp"
+
+using namespace shared_model::crypto;
+
+namespace {
+
+  int failures = 0;
+
+  void check(const std::string &name, bool ok) {
+    std::cout << (ok ? "PASS " : "FAIL ") << name << std::endl;
+    if (!ok) {
+      ++failures;
+    }
+  }
+
+  // Chuỗi hex (không có "0x") thành các byte big-endian
+  std::vector<uint8_t> hexBytes(const std::string &hex) {
+    std::vector<uint8_t> bytes;
+    for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+      bytes.push_back(
+          static_cast<uint8_t>(std::stoi(hex.substr(i, 2), nullptr, 16)));
+    }
+    return bytes;
+  }
+
+  const std::string kGx =
+      "0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798";
+  const std::string kGy =
+      "0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8";
+  // Tung độ của -G
+  const std::string kMinusGy =
+      "0xB7C52588D95C3B9AA25B0403F1EEF75702E84BB7597AABE663B82F6F04EF2777";
+
+  // Một chữ ký SHA-256 với khóa công khai Q
+  struct SignatureVector {
+    std::string name;
+    std::string qx;
+    std::string qy;
+    std::string hash;  // SHA-256 của thông điệp
+    std::string r;
+    std::string s;
+    int recid;  // Tính từ R = k * G, đã đảo bit 0 khi chuẩn hóa low-s
+  };
+
+  const SignatureVector kSignatures[] = {
+      {"d = 1, \"Satoshi Nakamoto\"",
+       kGx,
+       kGy,
+       "a0dc65ffca799873cbea0ac274015b9526505daaaed385155425f7337704883e",
+       "0x934B1EA10A4B3C1757E2B0C017D0B6143CE3C9A7E6A4A49860D7A6AB210EE3D8",
+       "0x2442CE9D2B916064108014783E923EC36B49743E2FFA1C4496F01A512AAFD9E5",
+       1},
+      {"d = 1, \"All those moments ...\"",
+       kGx,
+       kGy,
+       "7d1833f54854ac51659521afcd0ec6dca2ce2351429614bfa28a756b1b3c637f",
+       "0x8600DBD41E348FE5C9465AB92D23E3DB8B98B873BEECD930736488696438CB6B",
+       "0x547FE64427496DB33BF66019DACBF0039C04199ABB0122918601DB38A72CFC21",
+       0},
+      {"d = n - 1, \"Satoshi Nakamoto\"",
+       kGx,
+       kMinusGy,
+       "a0dc65ffca799873cbea0ac274015b9526505daaaed385155425f7337704883e",
+       "0xFD567D121DB66E382991534ADA77A6BD3106F0A1098C231E47993447CD6AF2D0",
+       "0x6B39CD0EB1BC8603E159EF5C20A5C8AD685A45B06CE9BEBED3F153D10D93BED5",
+       0},
+  };
+
+  Point pubkey(const SignatureVector &v) {
+    return Point(BigInt::from_hex(v.qx), BigInt::from_hex(v.qy));
+  }
+
+  EcdsaBatchEntry entry(const SignatureVector &v) {
+    return {pubkey(v),
+            hexBytes(v.hash),
+            BigInt::from_hex(v.r),
+            BigInt::from_hex(v.s),
+            v.recid};
+  }
+
+  std::string indices(const std::vector<size_t> &values) {
+    std::string result = "{";
+    for (size_t i : values) {
+      result += " " + std::to_string(i);
+    }
+    return result + " }";
+  }
+
+}  // namespace
+
+int main() {
+  EllipticCurve curve = namedCurve("secp256k1");
+  check("secp256k1 uses Secp256k1Field", curve.isSecp256k1());
+  const BigInt &n = curve.order();
+
+  for (const SignatureVector &v : kSignatures) {
+    const Point Q = pubkey(v);
+    const std::vector<uint8_t> hash = hexBytes(v.hash);
+    const BigInt r = BigInt::from_hex(v.r);
+    const BigInt s = BigInt::from_hex(v.s);
+
+    check("ecdsaVerify " + v.name, ecdsaVerify(curve, Q, hash, r, s));
+    check("ecdsaVerify " + v.name + " rejects s + 1",
+          !ecdsaVerify(curve, Q, hash, r, s + BigInt(1)));
+    check("ecdsaVerify " + v.name + " accepts high-s n - s",
+          ecdsaVerify(curve, Q, hash, r, n - s));
+
+    // recid của (r, n - s) là recid của (r, s) với bit 0 bị đảo
+    Point recovered;
+    check("ecdsaRecover " + v.name + " recid " + std::to_string(v.recid),
+          ecdsaRecover(curve, hash, r, s, v.recid, recovered)
+              && curve.coincide(recovered, Q));
+    check("ecdsaRecover " + v.name + " high-s recid "
+              + std::to_string(v.recid ^ 1),
+          ecdsaRecover(curve, hash, r, n - s, v.recid ^ 1, recovered)
+              && curve.coincide(recovered, Q));
+    check("ecdsaRecover " + v.name + " wrong recid gives another key",
+          !ecdsaRecover(curve, hash, r, s, v.recid ^ 1, recovered)
+              || !curve.coincide(recovered, Q));
+  }
+
+  std::vector<EcdsaBatchEntry> batch;
+  for (const SignatureVector &v : kSignatures) {
+    batch.push_back(entry(v));
+  }
+  std::vector<size_t> invalid = ecdsaVerifyBatch(curve, batch);
+  check("ecdsaVerifyBatch all valid " + indices(invalid), invalid.empty());
+
+  // Chữ ký thứ hai bị sửa: chỉ chỉ số 1 được trả về
+  std::vector<EcdsaBatchEntry> tampered = batch;
+  tampered[1].s = tampered[1].s + BigInt(1);
+  invalid = ecdsaVerifyBatch(curve, tampered);
+  check("ecdsaVerifyBatch one tampered entry " + indices(invalid),
+        invalid == std::vector<size_t>{1});
+
+  // Thiếu recid: không thể kiểm tra gộp, từng chữ ký được xác minh riêng
+  std::vector<EcdsaBatchEntry> missing = batch;
+  missing[2].recid = -1;
+  invalid = ecdsaVerifyBatch(curve, missing);
+  check("ecdsaVerifyBatch missing recid " + indices(invalid),
+        invalid.empty());
+  missing[0].s = missing[0].s + BigInt(1);
+  invalid = ecdsaVerifyBatch(curve, missing);
+  check("ecdsaVerifyBatch missing recid, one tampered entry "
+            + indices(invalid),
+        invalid == std::vector<size_t>{0});
+
+  std::cout << (failures == 0 ? "All secp256k1 vectors passed"
+                              : "Some secp256k1 vectors failed")
+            << std::endl;
+  return failures == 0 ? 0 : 1;
+}
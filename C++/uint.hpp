@@ -0,0 +1,380 @@
+#ifndef UINT_HPP
+#define UINT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "bigInt.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Số nguyên không dấu có độ rộng cố định Bits bit, nằm hoàn toàn trên
+     * stack (không cấp phát heap).
+     * @note Các limb 64-bit được lưu theo thứ tự little-endian
+     * @note Các phép +, -, * được tính theo modulo 2^Bits giống như các kiểu
+     * số nguyên không dấu có sẵn; dùng addCarry()/subBorrow()/mulWide() khi
+     * cần giữ lại phần tràn
+     * @note Bits phải là bội số của 64
+     */
+    template <size_t Bits>
+    class UInt {
+      static_assert(Bits > 0 && Bits % 64 == 0,
+                    "UInt width must be a positive multiple of 64");
+
+     public:
+      static constexpr size_t kLimbs = Bits / 64;
+
+      /*
+       * Constructor mặc định, giá trị 0
+       */
+      constexpr UInt() : limbs_{} {}
+
+      /*
+       * Constructor từ uint64_t
+       * @param value Giá trị uint64_t
+       */
+      constexpr explicit UInt(uint64_t value) : limbs_{} {
+        limbs_[0] = value;
+      }
+
+      /*
+       * Constructor từ BigInt
+       * @param value Giá trị BigInt
+       * @throws std::invalid_argument nếu value không vừa Bits bit
+       */
+      explicit UInt(const BigInt &value) : limbs_{} {
+        const std::vector<uint64_t> &src = value.limbs();
+        if (value.bit_length() > Bits) {
+          throw std::invalid_argument("BigInt does not fit in UInt");
+        }
+        for (size_t i = 0; i < src.size() && i < kLimbs; ++i) {
+          limbs_[i] = src[i];
+        }
+      }
+
+      /*
+       * Constructor chuyển đổi giữa các độ rộng khác nhau
+       * @param other UInt có độ rộng khác
+       * @note Nếu độ rộng đích nhỏ hơn, các limb cao bị cắt bỏ
+       */
+      template <size_t OtherBits>
+      constexpr explicit UInt(const UInt<OtherBits> &other) : limbs_{} {
+        for (size_t i = 0; i < kLimbs && i < UInt<OtherBits>::kLimbs; ++i) {
+          limbs_[i] = other.limbs()[i];
+        }
+      }
+
+      /*
+       * hàm from_hex() để tạo một UInt từ chuỗi hex
+       * @param hex_str Chuỗi hex (cùng định dạng với BigInt::from_hex)
+       * @return Đối tượng UInt tương ứng
+       * @throws std::invalid_argument nếu chuỗi không hợp lệ hoặc quá lớn
+       */
+      static UInt from_hex(const std::string &hex_str) {
+        return UInt(BigInt::from_hex(hex_str));
+      }
+
+      /*
+       * hàm toBigInt() để chuyển đổi sang BigInt (không mất mát)
+       * @return Đối tượng BigInt tương ứng
+       */
+      BigInt toBigInt() const {
+        return BigInt::from_limbs(limbs_.data(), kLimbs);
+      }
+
+      explicit operator BigInt() const {
+        return toBigInt();
+      }
+
+      std::string to_hex() const {
+        return toBigInt().to_hex();
+      }
+
+      const std::array<uint64_t, kLimbs> &limbs() const {
+        return limbs_;
+      }
+
+      std::array<uint64_t, kLimbs> &limbs() {
+        return limbs_;
+      }
+
+      bool isZero() const {
+        uint64_t acc = 0;
+        for (size_t i = 0; i < kLimbs; ++i) {
+          acc |= limbs_[i];
+        }
+        return acc == 0;
+      }
+
+      /*
+       * hàm bit_length() để tính số bit của UInt
+       * @return Số bit của UInt (0 nếu giá trị bằng 0)
+       */
+      size_t bit_length() const {
+        for (size_t i = kLimbs; i-- > 0;) {
+          if (limbs_[i] != 0) {
+            return i * 64
+                + (64 - static_cast<size_t>(__builtin_clzll(limbs_[i])));
+          }
+        }
+        return 0;
+      }
+
+      /*
+       * Kiểm tra xem bit thứ `pos` (0-based từ LSB) có bằng 1 không.
+       * @param pos Vị trí bit cần kiểm tra
+       * @return true nếu bit thứ `pos` là 1, false nếu không
+       */
+      bool test_bit(size_t pos) const {
+        if (pos >= Bits) {
+          return false;
+        }
+        return (limbs_[pos / 64] >> (pos % 64)) & 1;
+      }
+
+      /*
+       * Cộng rhs vào *this
+       * @param rhs Số hạng
+       * @return carry (0 hoặc 1) tràn ra khỏi bit cao nhất
+       */
+      uint64_t addCarry(const UInt &rhs) {
+        uint64_t carry = 0;
+        for (size_t i = 0; i < kLimbs; ++i) {
+          uint128_t sum = static_cast<uint128_t>(limbs_[i]) + rhs.limbs_[i]
+              + carry;
+          limbs_[i] = static_cast<uint64_t>(sum);
+          carry = static_cast<uint64_t>(sum >> 64);
+        }
+        return carry;
+      }
+
+      /*
+       * Trừ rhs khỏi *this
+       * @param rhs Số trừ
+       * @return borrow (0 hoặc 1), bằng 1 nếu *this < rhs trước khi trừ
+       */
+      uint64_t subBorrow(const UInt &rhs) {
+        uint64_t borrow = 0;
+        for (size_t i = 0; i < kLimbs; ++i) {
+          uint128_t diff = static_cast<uint128_t>(limbs_[i]) - rhs.limbs_[i]
+              - borrow;
+          limbs_[i] = static_cast<uint64_t>(diff);
+          borrow = static_cast<uint64_t>(diff >> 64) != 0 ? 1 : 0;
+        }
+        return borrow;
+      }
+
+      // Arithmetic operators (modulo 2^Bits)
+      UInt operator+(const UInt &rhs) const {
+        UInt result = *this;
+        result.addCarry(rhs);
+        return result;
+      }
+
+      UInt operator-(const UInt &rhs) const {
+        UInt result = *this;
+        result.subBorrow(rhs);
+        return result;
+      }
+
+      UInt operator*(const UInt &rhs) const {
+        UInt result;
+        for (size_t i = 0; i < kLimbs; ++i) {
+          uint128_t carry = 0;
+          // Chỉ cần các tích có chỉ số i + j < kLimbs
+          for (size_t j = 0; i + j < kLimbs; ++j) {
+            uint128_t product =
+                static_cast<uint128_t>(limbs_[i]) * rhs.limbs_[j]
+                + result.limbs_[i + j] + carry;
+            result.limbs_[i + j] = static_cast<uint64_t>(product);
+            carry = product >> 64;
+          }
+        }
+        return result;
+      }
+
+      UInt operator/(const UInt &rhs) const {
+        UInt quotient;
+        UInt remainder;
+        divmod(rhs, quotient, remainder);
+        return quotient;
+      }
+
+      UInt operator%(const UInt &rhs) const {
+        UInt quotient;
+        UInt remainder;
+        divmod(rhs, quotient, remainder);
+        return remainder;
+      }
+
+      UInt &operator+=(const UInt &rhs) {
+        addCarry(rhs);
+        return *this;
+      }
+      UInt &operator-=(const UInt &rhs) {
+        subBorrow(rhs);
+        return *this;
+      }
+      UInt &operator*=(const UInt &rhs) {
+        *this = *this * rhs;
+        return *this;
+      }
+      UInt &operator/=(const UInt &rhs) {
+        *this = *this / rhs;
+        return *this;
+      }
+      UInt &operator%=(const UInt &rhs) {
+        *this = *this % rhs;
+        return *this;
+      }
+
+      // Comparison operators
+      bool operator==(const UInt &rhs) const {
+        return limbs_ == rhs.limbs_;
+      }
+      bool operator!=(const UInt &rhs) const {
+        return !(*this == rhs);
+      }
+      bool operator<(const UInt &rhs) const {
+        for (size_t i = kLimbs; i-- > 0;) {
+          if (limbs_[i] != rhs.limbs_[i]) {
+            return limbs_[i] < rhs.limbs_[i];
+          }
+        }
+        return false;
+      }
+      bool operator<=(const UInt &rhs) const {
+        return !(rhs < *this);
+      }
+      bool operator>(const UInt &rhs) const {
+        return rhs < *this;
+      }
+      bool operator>=(const UInt &rhs) const {
+        return !(*this < rhs);
+      }
+
+      // Debug
+      friend std::ostream &operator<<(std::ostream &os, const UInt &u) {
+        return os << u.to_hex();
+      }
+
+     private:
+      /*
+       * Chia nhị phân không cấp phát bộ nhớ
+       * @param divisor Số chia
+       * @param quotient Thương
+       * @param remainder Số dư
+       * @throws std::invalid_argument nếu divisor = 0
+       */
+      void divmod(const UInt &divisor, UInt &quotient, UInt &remainder) const {
+        if (divisor.isZero()) {
+          throw std::invalid_argument("Division by zero");
+        }
+        quotient = UInt();
+        remainder = UInt();
+        for (size_t i = bit_length(); i-- > 0;) {
+          // remainder = remainder * 2 + bit i, giữ lại bit tràn
+          uint64_t overflow = remainder.limbs_[kLimbs - 1] >> 63;
+          for (size_t j = kLimbs - 1; j > 0; --j) {
+            remainder.limbs_[j] =
+                (remainder.limbs_[j] << 1) | (remainder.limbs_[j - 1] >> 63);
+          }
+          remainder.limbs_[0] = (remainder.limbs_[0] << 1)
+              | static_cast<uint64_t>(test_bit(i));
+
+          // Giá trị thực < 2 * divisor nên phép trừ theo modulo 2^Bits
+          // luôn cho kết quả đúng
+          if (overflow != 0 || remainder >= divisor) {
+            remainder.subBorrow(divisor);
+            quotient.limbs_[i / 64] |= uint64_t(1) << (i % 64);
+          }
+        }
+      }
+
+      std::array<uint64_t, kLimbs> limbs_;
+    };
+
+    /*
+     * Hàm nhân đầy đủ hai UInt, không mất phần cao
+     * @param lhs Thừa số thứ nhất
+     * @param rhs Thừa số thứ hai
+     * @return Tích có độ rộng LhsBits + RhsBits
+     */
+    template <size_t LhsBits, size_t RhsBits>
+    UInt<LhsBits + RhsBits> mulWide(const UInt<LhsBits> &lhs,
+                                    const UInt<RhsBits> &rhs) {
+      UInt<LhsBits + RhsBits> result;
+      auto &out = result.limbs();
+      for (size_t i = 0; i < UInt<LhsBits>::kLimbs; ++i) {
+        uint128_t carry = 0;
+        for (size_t j = 0; j < UInt<RhsBits>::kLimbs; ++j) {
+          uint128_t product =
+              static_cast<uint128_t>(lhs.limbs()[i]) * rhs.limbs()[j]
+              + out[i + j] + carry;
+          out[i + j] = static_cast<uint64_t>(product);
+          carry = product >> 64;
+        }
+        out[i + UInt<RhsBits>::kLimbs] = static_cast<uint64_t>(carry);
+      }
+      return result;
+    }
+
+    /*
+     * Hàm bình phương đầy đủ một UInt, không mất phần cao
+     * @param x Số cần bình phương
+     * @return x^2 có độ rộng 2 * Bits
+     * @note Các tích chéo a[i] * a[j] (i < j) chỉ tính một lần rồi nhân đôi:
+     * k(k + 1) / 2 phép nhân limb thay vì k^2
+     */
+    template <size_t Bits>
+    UInt<2 * Bits> sqrWide(const UInt<Bits> &x) {
+      constexpr size_t k = UInt<Bits>::kLimbs;
+      const auto &a = x.limbs();
+      UInt<2 * Bits> result;
+      auto &w = result.limbs();
+
+      // 1. Các tích chéo a[i] * a[j] với i < j
+      for (size_t i = 0; i < k; ++i) {
+        uint64_t carry = 0;
+        for (size_t j = i + 1; j < k; ++j) {
+          uint128_t cur = static_cast<uint128_t>(a[i]) * a[j] + w[i + j] + carry;
+          w[i + j] = static_cast<uint64_t>(cur);
+          carry = static_cast<uint64_t>(cur >> 64);
+        }
+        w[i + k] = carry;
+      }
+
+      // 2. Nhân đôi các tích chéo
+      for (size_t i = 2 * k - 1; i > 0; --i) {
+        w[i] = (w[i] << 1) | (w[i - 1] >> 63);
+      }
+      w[0] <<= 1;
+
+      // 3. Cộng các bình phương a[i]^2
+      uint64_t carry = 0;
+      for (size_t i = 0; i < k; ++i) {
+        uint128_t sq = static_cast<uint128_t>(a[i]) * a[i];
+        uint128_t lo = static_cast<uint128_t>(w[2 * i])
+            + static_cast<uint64_t>(sq) + carry;
+        w[2 * i] = static_cast<uint64_t>(lo);
+        uint128_t hi = static_cast<uint128_t>(w[2 * i + 1])
+            + static_cast<uint64_t>(sq >> 64) + static_cast<uint64_t>(lo >> 64);
+        w[2 * i + 1] = static_cast<uint64_t>(hi);
+        carry = static_cast<uint64_t>(hi >> 64);
+      }
+      return result;
+    }
+
+    using U256 = UInt<256>;
+    using U512 = UInt<512>;
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // UINT_HPP
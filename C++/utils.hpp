@@ -5,20 +5,37 @@
 #include <vector>
 
 #include "bigInt.hpp"
-#include "elliptic_curve.hpp"
+#include "point.hpp"
 
 namespace shared_model {
   namespace crypto {
 
+    class EllipticCurve;
+
     /*
      * Hàm tính lũy thừa của base với exp theo modulo mod
      * @param base Cơ sở
      * @param exp Số mũ
      * @param mod Modulo
      * @return Kết quả của (base^exp) mod mod
+     * @note Với mod lẻ, phép tính dùng nhân Montgomery (không có phép chia
+     * trong vòng lặp); cả hai nhánh dùng sliding-window (window_pow.hpp)
      */
     BigInt pow_mod(BigInt base, BigInt exp, const BigInt &mod);
 
+    /*
+     * Các phép cộng, trừ, đổi dấu theo modulo m không bao giờ tạo giá trị âm
+     * (BigInt::operator- ném ngoại lệ khi hiệu âm)
+     * @param a, b Các số trong [0, m)
+     * @param m Modulo
+     * @return (a + b) mod m, (a - b) mod m, (-a) mod m, đều trong [0, m)
+     * @note Chỉ cần một phép so sánh và tối đa một phép trừ m, không có
+     * phép chia
+     */
+    BigInt addMod(const BigInt &a, const BigInt &b, const BigInt &m);
+    BigInt subMod(const BigInt &a, const BigInt &b, const BigInt &m);
+    BigInt negMod(const BigInt &a, const BigInt &m);
+
     /// @brief Sinh số ngẫu nhiên an toàn trong khoảng [low, high]
     /// @param low Giới hạn dưới
     /// @param high Giới hạn trên
@@ -28,14 +45,59 @@ namespace shared_model {
     /// high
     BigInt secureRandom(const BigInt &low, const BigInt &high);
 
+    /*
+     * Hàm sinh hệ số ngẫu nhiên cho các phép kiểm tra gộp (verifyBatch(),
+     * ecdsaVerifyBatch())
+     * @param order Bậc q của nhóm
+     * @return Số ngẫu nhiên trong [1, min(q - 1, 2^128 - 1)]
+     * @note Một lô có phần tử sai bị chấp nhận với xác suất không quá
+     * 1 / min(q, 2^128)
+     */
+    BigInt randomBatchCoefficient(const BigInt &order);
+
+    /*
+     * Hàm so sánh hai điểm, coi hai điểm vô cực là bằng nhau (khác với
+     * EllipticCurve::coincide)
+     * @param curve Đường cong elliptic
+     * @param P, Q Các điểm cần so sánh
+     * @return true nếu P = Q, kể cả khi cả hai là điểm vô cực
+     */
+    bool samePoint(const EllipticCurve &curve, const Point &P, const Point &Q);
+
     /*
      * Hàm tính nghịch đảo modulo của k với q
      * @param k Số nguyên cần tính nghịch đảo
      * @param q Modulo
      * @return Nghịch đảo của k mod q
+     * @note Dùng Euclid mở rộng nhị phân trên các limb (tryInverseMod)
+     * @throws std::invalid_argument nếu k = 0 hoặc k không có nghịch đảo
+     * modulo q
      */
     BigInt inverseMod(const BigInt &k, const BigInt &q);
 
+    /*
+     * Hàm nghịch đảo nhiều số cùng lúc theo modulo q (Montgomery's trick)
+     * @param values Các số cần tính nghịch đảo
+     * @param q Modulo
+     * @return values[i]^-1 mod q theo đúng thứ tự
+     * @note Chỉ một lần inverseMod() cộng 3(k - 1) phép nhân mod q cho k số
+     * @throws std::invalid_argument nếu có số bằng 0 mod q hoặc không có
+     * nghịch đảo modulo q
+     */
+    std::vector<BigInt> batchInverse(const std::vector<BigInt> &values,
+                                     const BigInt &q);
+
+    /*
+     * Hàm tính căn bậc hai modulo số nguyên tố lẻ p
+     * @param a Số cần lấy căn
+     * @param p Số nguyên tố lẻ
+     * @param root Nhận một căn bậc hai của a mod p nếu có
+     * @return true nếu a là số chính phương mod p, false nếu không
+     * @note Với p = 3 mod 4, root = a^((p + 1) / 4); các trường hợp khác dùng
+     * thuật toán Tonelli-Shanks
+     */
+    bool sqrtMod(const BigInt &a, const BigInt &p, BigInt &root);
+
     /*
      * Hàm kiểm tra xem p có phải là số nguyên tố hay không
      * @param p Số nguyên cần kiểm tra
@@ -62,8 +124,11 @@ namespace shared_model {
      * Hàm thực hiện Lagrange interpolation
      * @param shares Bảng chia sẻ
      * @param indices Chỉ số của các phần tử trong shares
-     * @param q Modulo
+     * @param q Modulo (số nguyên tố)
+     * @note q tối đa 256 bit dùng rút gọn Barrett của ScalarField; q lớn hơn
+     * dùng phép toán BigInt
      * @return Kết quả Lagrange interpolation
+     * @throws std::invalid_argument nếu có chỉ số âm
      */
     LagrangeResult lagrangeInterpolation(const std::map<int, BigInt> &shares,
                                          const std::vector<int> &indices,
@@ -79,6 +144,7 @@ namespace shared_model {
      * @param coeffs Danh sách các hệ số của đa thức, trong đó phần tử đầu tiên là khóa bí mật 
      * @param q Số nguyên tố dùng cho phép toán modulo
      * @return Phần chia p(xi) mod q
+     * @throws std::invalid_argument nếu x âm
      */
     BigInt shamirShare(int x,
                   const std::vector<BigInt> &coeffs,
@@ -101,12 +167,32 @@ namespace shared_model {
       * @param id Chỉ số của phần tử cần xác minh
       * @param curve Đường cong elliptic
       * @return true nếu chia sẻ hợp lệ, false nếu không
+      * @throws std::invalid_argument nếu id hoặc chỉ số trong v âm
     */
     bool verify(const std::map<int, Point> &v,
                 BigInt sigma_i,
                 int id,
                 const EllipticCurve &curve);
 
+    /*
+     * Hàm xác minh nhiều chia sẻ cùng lúc với cùng bảng cam kết v:
+     *   g^(sum r_j * sigma_j) = sum_i (sum_j r_j * id_j^i) * v_i
+     *   với r_j ngẫu nhiên (tối đa 128 bit)
+     * @param v Bảng chia sẻ
+     * @param shares Bảng id -> sigma_id của các chia sẻ cần xác minh
+     * @param curve Đường cong elliptic (phải đã biết bậc của điểm sinh)
+     * @return Danh sách id của các chia sẻ không hợp lệ (rỗng nếu tất cả hợp
+     * lệ)
+     * @note Chỉ cần một phép nhân đa vô hướng cho cả lô; nếu kiểm tra gộp
+     * thất bại, từng chia sẻ được xác minh lại bằng verify() để tìm chia sẻ
+     * sai
+     * @note Một lô có chia sẻ sai bị chấp nhận với xác suất không quá
+     * 1 / min(q, 2^128), q là bậc của điểm sinh
+     */
+    std::vector<int> verifyBatch(const std::map<int, Point> &v,
+                                 const std::map<int, BigInt> &shares,
+                                 const EllipticCurve &curve);
+
   }  // namespace crypto
 }  // namespace shared_model
 
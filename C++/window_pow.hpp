@@ -0,0 +1,98 @@
+#ifndef WINDOW_POW_HPP
+#define WINDOW_POW_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Hàm chọn độ rộng cửa sổ cho lũy thừa sliding-window
+     * @param bits Số bit của số mũ
+     * @return Độ rộng w; bảng lũy thừa lẻ có 2^(w-1) phần tử
+     * @note Cân bằng chi phí dựng bảng với số phép nhân tiết kiệm được,
+     * khoảng bits / (w + 1) phép nhân thay vì bits / 2
+     */
+    inline size_t powWindowWidth(size_t bits) {
+      if (bits > 671) {
+        return 6;
+      }
+      if (bits > 239) {
+        return 5;
+      }
+      if (bits > 79) {
+        return 4;
+      }
+      if (bits > 23) {
+        return 3;
+      }
+      return 1;
+    }
+
+    /*
+     * Hàm lũy thừa sliding-window với bảng các lũy thừa lẻ
+     * base, base^3, ..., base^(2^w - 1)
+     * @param acc Giá trị 1 của nhóm; nhận base^exp
+     * @param base Cơ sở
+     * @param exp Số mũ (BigInt hoặc UInt, cần bit_length() và test_bit())
+     * @param sqr Hàm bình phương tại chỗ: sqr(x) gán x = x * x
+     * @param mul Hàm nhân tại chỗ: mul(x, y) gán x = x * y
+     * @note Bỏ qua các phép bình phương giá trị 1 ở đầu: cửa sổ đầu tiên
+     * được lấy thẳng từ bảng
+     */
+    template <class T, class Exp, class Sqr, class Mul>
+    void slidingWindowPow(
+        T &acc, const T &base, const Exp &exp, Sqr sqr, Mul mul) {
+      const size_t width = powWindowWidth(exp.bit_length());
+
+      // table[i] = base^(2i + 1)
+      std::vector<T> table;
+      table.reserve(size_t(1) << (width - 1));
+      table.push_back(base);
+      if (width > 1) {
+        T base2 = base;
+        sqr(base2);
+        for (size_t i = 1; i < (size_t(1) << (width - 1)); ++i) {
+          T next = table.back();
+          mul(next, base2);
+          table.push_back(next);
+        }
+      }
+
+      bool started = false;
+      size_t i = exp.bit_length();
+      while (i > 0) {
+        if (!exp.test_bit(i - 1)) {
+          if (started) {
+            sqr(acc);
+          }
+          --i;
+          continue;
+        }
+        // Cửa sổ [j, i) dài tối đa w bit, bit thấp nhất là 1
+        size_t j = i > width ? i - width : 0;
+        while (!exp.test_bit(j)) {
+          ++j;
+        }
+        size_t value = 0;
+        for (size_t k = i; k-- > j;) {
+          if (started) {
+            sqr(acc);
+          }
+          value = (value << 1) | static_cast<size_t>(exp.test_bit(k));
+        }
+        if (started) {
+          mul(acc, table[value >> 1]);
+        } else {
+          acc = table[value >> 1];
+          started = true;
+        }
+        i = j;
+      }
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // WINDOW_POW_HPP
@@ -0,0 +1,63 @@
+#include "wnaf.hpp"
+
+#include <stdexcept>
+
+namespace shared_model {
+  namespace crypto {
+
+    std::vector<int8_t> computeWnaf(const BigInt &k, size_t width) {
+      if (width < 2 || width > 8) {
+        throw std::invalid_argument("wNAF width must be in [2, 8]");
+      }
+
+      // Làm việc trực tiếp trên bản sao các limb, thêm một limb cho carry
+      std::vector<uint64_t> limbs = k.limbs();
+      limbs.push_back(0);
+
+      const int64_t window = int64_t(1) << width;
+      const int64_t half = window >> 1;
+      std::vector<int8_t> naf;
+      naf.reserve(k.bit_length() + 1);
+
+      auto is_zero = [&limbs]() {
+        for (uint64_t limb : limbs) {
+          if (limb != 0) {
+            return false;
+          }
+        }
+        return true;
+      };
+
+      while (!is_zero()) {
+        int64_t digit = 0;
+        if (limbs[0] & 1) {
+          // digit = k mods 2^w, nằm trong (-2^(w-1), 2^(w-1))
+          digit = static_cast<int64_t>(limbs[0] & static_cast<uint64_t>(window - 1));
+          if (digit >= half) {
+            digit -= window;
+          }
+          if (digit > 0) {
+            // k -= digit: chỉ ảnh hưởng các bit thấp, không mượn
+            limbs[0] -= static_cast<uint64_t>(digit);
+          } else {
+            // k += -digit, có thể có carry
+            uint64_t add = static_cast<uint64_t>(-digit);
+            for (size_t i = 0; i < limbs.size() && add != 0; ++i) {
+              limbs[i] += add;
+              add = limbs[i] < add ? 1 : 0;
+            }
+          }
+        }
+        naf.push_back(static_cast<int8_t>(digit));
+
+        // k >>= 1
+        for (size_t i = 0; i + 1 < limbs.size(); ++i) {
+          limbs[i] = (limbs[i] >> 1) | (limbs[i + 1] << 63);
+        }
+        limbs.back() >>= 1;
+      }
+      return naf;
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
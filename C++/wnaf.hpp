@@ -0,0 +1,166 @@
+#ifndef WNAF_HPP
+#define WNAF_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "bigInt.hpp"
+#include "jacobian.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /*
+     * Hàm biểu diễn k ở dạng width-w NAF
+     * @param k Số nguyên không âm
+     * @param width Độ rộng cửa sổ w, trong [2, 8]
+     * @return Các chữ số từ bit thấp đến bit cao; mỗi chữ số là 0 hoặc một số
+     * lẻ trong (-2^(w-1), 2^(w-1)), và hai chữ số khác 0 cách nhau ít nhất w
+     * vị trí
+     * @throws std::invalid_argument nếu width không hợp lệ
+     */
+    std::vector<int8_t> computeWnaf(const BigInt &k, size_t width);
+
+    template <class Field>
+    JacobianPoint<Field> jacobianNegate(const Field &F,
+                                        const JacobianPoint<Field> &P) {
+      return {P.X, F.neg(P.Y), P.Z};
+    }
+
+    /*
+     * Hàm tính các bội lẻ P, 3P, ..., (2^(w-1) - 1)P
+     * @param F FieldOps của đường cong
+     * @param P Điểm cơ sở
+     * @param width Độ rộng cửa sổ w
+     * @return 2^(w-2) điểm ở tọa độ Jacobian
+     */
+    template <class Field>
+    std::vector<JacobianPoint<Field>> oddMultiples(
+        const Field &F, const JacobianPoint<Field> &P, size_t width) {
+      std::vector<JacobianPoint<Field>> table;
+      table.reserve(size_t(1) << (width - 2));
+      table.push_back(P);
+      JacobianPoint<Field> twice = jacobianDouble(F, P);
+      for (size_t i = 1; i < (size_t(1) << (width - 2)); ++i) {
+        table.push_back(jacobianAdd(F, table.back(), twice));
+      }
+      return table;
+    }
+
+    /*
+     * Hàm cộng chữ số wNAF digit * P vào R, với table là các bội lẻ của P
+     */
+    template <class Field>
+    JacobianPoint<Field> wnafAddDigit(
+        const Field &F,
+        const JacobianPoint<Field> &R,
+        const std::vector<JacobianPoint<Field>> &table,
+        int digit) {
+      if (digit > 0) {
+        return jacobianAdd(F, R, table[static_cast<size_t>(digit - 1) / 2]);
+      }
+      if (digit < 0) {
+        return jacobianAdd(
+            F, R, jacobianNegate(F, table[static_cast<size_t>(-digit - 1) / 2]));
+      }
+      return R;
+    }
+
+    /*
+     * Hàm nhân điểm với số nguyên dùng width-w NAF
+     * @param F FieldOps của đường cong
+     * @param P Điểm cần nhân (affine)
+     * @param k Số nguyên không âm
+     * @param width Độ rộng cửa sổ w, trong [2, 8]
+     * @return k * P ở tọa độ Jacobian
+     * @note Cần khoảng bits phép nhân đôi nhưng chỉ khoảng bits / (w + 1)
+     * phép cộng, cộng thêm 2^(w-2) phép cộng để dựng bảng bội lẻ
+     */
+    template <class Field>
+    JacobianPoint<Field> wnafMultiply(const Field &F,
+                                      const AffinePoint<Field> &P,
+                                      const BigInt &k,
+                                      size_t width) {
+      std::vector<int8_t> naf = computeWnaf(k, width);
+      if (P.infinity || naf.empty()) {
+        return jacobianInfinity(F);
+      }
+      std::vector<JacobianPoint<Field>> table =
+          oddMultiples(F, toJacobian(F, P), width);
+
+      JacobianPoint<Field> R = jacobianInfinity(F);
+      for (size_t i = naf.size(); i-- > 0;) {
+        R = jacobianDouble(F, R);
+        R = wnafAddDigit(F, R, table, naf[i]);
+      }
+      return R;
+    }
+
+    /*
+     * Hàm tính tổng scalars[i] * points[i] theo Strauss: mỗi điểm có bảng bội
+     * lẻ và biểu diễn wNAF riêng, nhưng mọi điểm dùng chung một chuỗi nhân đôi
+     * @param F FieldOps của đường cong
+     * @param points Các điểm (affine)
+     * @param scalars Các số nhân không âm, cùng kích thước với points
+     * @param width Độ rộng cửa sổ w, trong [2, 8]
+     * @return Tổng ở tọa độ Jacobian
+     * @note Số phép nhân đôi bằng số bit của số nhân lớn nhất thay vì tổng
+     * theo từng điểm; phù hợp với số điểm nhỏ (xem msm.hpp)
+     */
+    template <class Field>
+    JacobianPoint<Field> straussMultiply(
+        const Field &F,
+        const std::vector<AffinePoint<Field>> &points,
+        const std::vector<BigInt> &scalars,
+        size_t width) {
+      std::vector<std::vector<int8_t>> nafs;
+      std::vector<std::vector<JacobianPoint<Field>>> tables;
+      size_t length = 0;
+      for (size_t i = 0; i < points.size(); ++i) {
+        std::vector<int8_t> naf = computeWnaf(scalars[i], width);
+        if (points[i].infinity || naf.empty()) {
+          continue;
+        }
+        length = std::max(length, naf.size());
+        tables.push_back(oddMultiples(F, toJacobian(F, points[i]), width));
+        nafs.push_back(std::move(naf));
+      }
+
+      JacobianPoint<Field> R = jacobianInfinity(F);
+      for (size_t i = length; i-- > 0;) {
+        R = jacobianDouble(F, R);
+        for (size_t j = 0; j < nafs.size(); ++j) {
+          if (i < nafs[j].size()) {
+            R = wnafAddDigit(F, R, tables[j], nafs[j][i]);
+          }
+        }
+      }
+      return R;
+    }
+
+    /*
+     * Hàm tính k * P + l * Q bằng một chuỗi nhân đôi chung (Shamir's trick)
+     * @param F FieldOps của đường cong
+     * @param P Điểm thứ nhất (affine)
+     * @param k Số nhân của P, không âm
+     * @param Q Điểm thứ hai (affine)
+     * @param l Số nhân của Q, không âm
+     * @param width Độ rộng cửa sổ w, trong [2, 8]
+     * @return k * P + l * Q ở tọa độ Jacobian
+     */
+    template <class Field>
+    JacobianPoint<Field> jointWnafMultiply(const Field &F,
+                                           const AffinePoint<Field> &P,
+                                           const BigInt &k,
+                                           const AffinePoint<Field> &Q,
+                                           const BigInt &l,
+                                           size_t width) {
+      return straussMultiply(F, {P, Q}, {k, l}, width);
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // WNAF_HPP